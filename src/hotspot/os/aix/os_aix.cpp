@@ -1890,6 +1890,13 @@ bool os::remove_stack_guard_pages(char* addr, size_t size) {
 void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
 }
 
+void os::pd_collapse_memory(char *addr, size_t bytes) {
+}
+
+bool os::pd_pretouch_memory(void* first, void* last, size_t page_size) {
+  return false;
+}
+
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) {
 }
 
@@ -1607,6 +1607,13 @@ void os::pd_commit_memory_or_exit(char* addr, size_t size,
 void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
 }
 
+void os::pd_collapse_memory(char *addr, size_t bytes) {
+}
+
+bool os::pd_pretouch_memory(void* first, void* last, size_t page_size) {
+  return false;
+}
+
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) {
   ::madvise(addr, bytes, MADV_DONTNEED);
 }
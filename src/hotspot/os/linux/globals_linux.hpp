@@ -50,6 +50,15 @@
   product(bool, UseTransparentHugePages, false,                         \
           "Use MADV_HUGEPAGE for large pages")                          \
                                                                         \
+  product(bool, THPCollapseOnCommit, false, EXPERIMENTAL,               \
+          "With UseTransparentHugePages, also madvise(MADV_COLLAPSE) "  \
+          "the code heaps when they are committed, so that compiled "   \
+          "code is backed by huge pages immediately")                   \
+                                                                        \
+  product(bool, UseMadvPopulateWrite, true, DIAGNOSTIC,                 \
+          "Use madvise(MADV_POPULATE_WRITE) to pretouch memory where "  \
+          "the kernel supports it")                                     \
+                                                                        \
   product(bool, LoadExecStackDllInVMThread, true,                       \
           "Load DLLs with executable-stack attribute in the VM Thread") \
                                                                         \
@@ -2869,6 +2869,11 @@ void os::pd_commit_memory_or_exit(char* addr, size_t size,
   }
 }
 
+// Define MADV_COLLAPSE here so we can build HotSpot on old systems.
+#ifndef MADV_COLLAPSE
+  #define MADV_COLLAPSE 25
+#endif
+
 void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   if (UseTransparentHugePages && alignment_hint > vm_page_size()) {
     // We don't check the return value: madvise(MADV_HUGEPAGE) may not
@@ -2877,6 +2882,42 @@ void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   }
 }
 
+void os::pd_collapse_memory(char *addr, size_t bytes) {
+  if (UseTransparentHugePages && THPCollapseOnCommit) {
+    // Ask the kernel (5.19+) to back the range with huge pages right away
+    // instead of waiting for khugepaged. Failure is not an error; the
+    // range then stays on small pages until khugepaged gets to it.
+    if (::madvise(addr, bytes, MADV_COLLAPSE) != 0) {
+      log_debug(pagesize)("MADV_COLLAPSE failed for " PTR_FORMAT " - " PTR_FORMAT ": %s",
+                          p2i(addr), p2i(addr + bytes), os::strerror(errno));
+    }
+  }
+}
+
+// Define MADV_POPULATE_WRITE here so we can build HotSpot on old systems.
+#ifndef MADV_POPULATE_WRITE
+  #define MADV_POPULATE_WRITE 23
+#endif
+
+bool os::pd_pretouch_memory(void* first, void* last, size_t page_size) {
+  if (!UseMadvPopulateWrite) {
+    return false;
+  }
+  // Let the kernel (5.14+) populate the whole range in one call instead of
+  // taking one page fault per page. With THP this also lets huge pages form
+  // right away. Kernels without support return EINVAL; fall back to touching.
+  const size_t len = pointer_delta(last, first, sizeof(char)) + page_size;
+  if (::madvise(first, len, MADV_POPULATE_WRITE) == 0) {
+    return true;
+  }
+  int err = errno;
+  if (err != EINVAL) {
+    log_info(gc, os)("::madvise(" PTR_FORMAT ", " SIZE_FORMAT ", MADV_POPULATE_WRITE) failed; "
+                     "error='%s' (errno=%d)", p2i(first), len, os::strerror(err), err);
+  }
+  return false;
+}
+
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) {
   // This method works by doing an mmap over an existing mmaping and effectively discarding
   // the existing pages. However it won't work for SHM-based large pages that cannot be
@@ -3144,7 +3144,10 @@ void LinearScan::do_linear_scan() {
 #ifndef RISCV
   // Disable these optimizations on riscv temporarily, because it does not
   // work when the comparison operands are bound to branches or cmoves.
-  { TIME_LINEAR_SCAN(timer_optimize_lir);
+  // Code compiled with profiling is short-lived, so for small methods
+  // compilation speed matters more than the moves and jumps saved here.
+  if (!compilation()->is_profiling() || _lir_ops.length() >= C1OptimizeProfiledLIRMinSize) {
+    TIME_LINEAR_SCAN(timer_optimize_lir);
 
     EdgeMoveOptimizer::optimize(ir()->code());
     ControlFlowOptimizer::optimize(ir()->code());
@@ -213,6 +213,13 @@
   product(bool, TimeLinearScan, false,                                      \
           "detailed timing of LinearScan phases")                           \
                                                                             \
+  product(intx, C1OptimizeProfiledLIRMinSize, 0, DIAGNOSTIC,                \
+          "Minimum number of LIR operations a method compiled with "        \
+          "profiling must have for the LIR to be optimized after register " \
+          "allocation. Smaller methods are compiled faster without it. "    \
+          "0 optimizes all methods")                                        \
+          range(0, max_jint)                                                \
+                                                                            \
   develop(bool, TimeEachLinearScan, false,                                  \
           "print detailed timing of each LinearScan run")                   \
                                                                             \
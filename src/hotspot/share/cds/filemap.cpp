@@ -42,6 +42,8 @@
 #include "classfile/systemDictionaryShared.hpp"
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "jvm.h"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
@@ -57,6 +59,7 @@
 #include "oops/oop.inline.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/java.hpp"
 #include "runtime/mutexLocker.hpp"
@@ -1857,10 +1860,40 @@ char* FileMapInfo::map_bitmap_region() {
   return bitmap_base;
 }
 
+// Patches the pointers marked in a range of the relocation bitmap. Workers
+// claim fixed-size chunks of the bitmap; each marked bit is a distinct word
+// in the archive, so chunks can be patched independently.
+class SharedDataRelocationTask : public WorkerTask {
+  BitMapView* const _ptrmap;
+  SharedDataRelocator* const _patcher;
+  const size_t _chunk_bits;
+  const size_t _num_chunks;
+  volatile size_t _next_chunk;
+
+public:
+  SharedDataRelocationTask(BitMapView* ptrmap, SharedDataRelocator* patcher, size_t chunk_bits) :
+    WorkerTask("CDS Relocation"),
+    _ptrmap(ptrmap),
+    _patcher(patcher),
+    _chunk_bits(chunk_bits),
+    _num_chunks(align_up(ptrmap->size(), chunk_bits) / chunk_bits),
+    _next_chunk(0) {}
+
+  void work(uint worker_id) {
+    size_t chunk;
+    while ((chunk = Atomic::fetch_then_add(&_next_chunk, (size_t)1)) < _num_chunks) {
+      BitMap::idx_t beg = chunk * _chunk_bits;
+      BitMap::idx_t end = MIN2(beg + _chunk_bits, _ptrmap->size());
+      _ptrmap->iterate(_patcher, beg, end);
+    }
+  }
+};
+
 // This is called when we cannot map the archive at the requested[ base address (usually 0x800000000).
 // We relocate all pointers in the 2 core regions (ro, rw).
 bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
   log_debug(cds, reloc)("runtime archive relocation start");
+  jlong start_ns = os::javaTimeNanos();
   char* bitmap_base = map_bitmap_region();
 
   if (bitmap_base == nullptr) {
@@ -1889,11 +1922,29 @@ bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
 
     SharedDataRelocator patcher((address*)patch_base, (address*)patch_end, valid_old_base, valid_old_end,
                                 valid_new_base, valid_new_end, addr_delta);
-    ptrmap.iterate(&patcher);
+
+    // The heap is initialized before the archive is mapped, so its workers
+    // can share the patching of large archives. Only use the workers that
+    // already exist: with UseDynamicNumberOfGCThreads, creating more of them
+    // here would cost about as much as the patching saves.
+    const size_t chunk_bits = 256 * K;
+    WorkerThreads* workers = Universe::heap() != nullptr ? Universe::heap()->safepoint_workers() : nullptr;
+    uint num_workers = workers == nullptr ? 1 :
+                       (uint)MIN2((size_t)workers->created_workers(), ptrmap_size_in_bits / chunk_bits);
+    if (num_workers > 1) {
+      SharedDataRelocationTask task(&ptrmap, &patcher, chunk_bits);
+      workers->run_task(&task, num_workers);
+    } else {
+      num_workers = 1;
+      ptrmap.iterate(&patcher);
+    }
 
     // The MetaspaceShared::bm region will be unmapped in MetaspaceShared::initialize_shared_spaces().
 
     log_debug(cds, reloc)("runtime archive relocation done");
+    log_info(cds, reloc)("Relocated archive pointers (" SIZE_FORMAT " bitmap bits) with %u worker(s) in %.3f ms",
+                         ptrmap_size_in_bits, num_workers,
+                         (double)(os::javaTimeNanos() - start_ns) / NANOSECS_PER_MILLISEC);
     return true;
   }
 }
@@ -83,6 +83,28 @@ class java_lang_String : AllStatic {
 
   static inline unsigned int hash_code_impl(oop java_string, bool update);
 
+  static unsigned int hash_char(jchar c) { return (unsigned int)c; }
+  static unsigned int hash_char(jbyte c) { return ((unsigned int)c) & 0xFF; }
+
+  // h = 31*h + c, folded four characters at a time so that the multiplies
+  // of one step do not depend on each other.
+  template <typename T>
+  static unsigned int hash_code_unrolled(const T* s, int len) {
+    unsigned int h = 0;
+    int i = 0;
+    for (; i + 4 <= len; i += 4) {
+      h = 923521 * h +                    // 31^4
+          29791 * hash_char(s[i]) +       // 31^3
+          961 * hash_char(s[i + 1]) +     // 31^2
+          31 * hash_char(s[i + 2]) +
+          hash_char(s[i + 3]);
+    }
+    for (; i < len; i++) {
+      h = 31 * h + hash_char(s[i]);
+    }
+    return h;
+  }
+
  public:
 
   // Coders
@@ -159,21 +181,11 @@ class java_lang_String : AllStatic {
   //
   // For this reason, THIS ALGORITHM MUST MATCH String.hashCode().
   static unsigned int hash_code(const jchar* s, int len) {
-    unsigned int h = 0;
-    while (len-- > 0) {
-      h = 31*h + (unsigned int) *s;
-      s++;
-    }
-    return h;
+    return hash_code_unrolled(s, len);
   }
 
   static unsigned int hash_code(const jbyte* s, int len) {
-    unsigned int h = 0;
-    while (len-- > 0) {
-      h = 31*h + (((unsigned int) *s) & 0xFF);
-      s++;
-    }
-    return h;
+    return hash_code_unrolled(s, len);
   }
 
   static unsigned int hash_code(oop java_string);
@@ -99,6 +99,13 @@ static volatile bool _lookup_shared_first = false;
 // "_lookup_shared_first" can get highly contended with many cores if multiple threads
 // are updating "lookup success history" in a global shared variable. If built-in TLS is available, use it.
 static THREAD_LOCAL bool _lookup_shared_first = false;
+
+// Small direct-mapped cache of recently found permanent symbols, indexed by hash.
+// Class parsing looks up the same names (java/lang/Object, common descriptors)
+// over and over; permanent symbols are never freed, so a hit needs neither a
+// table probe nor refcount bookkeeping.
+static const int PermanentSymbolCacheSize = 64;
+static THREAD_LOCAL Symbol* _permanent_symbol_cache[PermanentSymbolCacheSize];
 #endif
 
 // Static arena for symbols that are not deallocated
@@ -319,6 +326,14 @@ Symbol* SymbolTable::lookup_shared(const char* name,
 Symbol* SymbolTable::lookup_common(const char* name,
                             int len, unsigned int hash) {
   Symbol* sym;
+#ifndef USE_LIBRARY_BASED_TLS_ONLY
+  Symbol** cache_slot = &_permanent_symbol_cache[hash % PermanentSymbolCacheSize];
+  sym = *cache_slot;
+  if (sym != nullptr && sym->equals(name, len)) {
+    assert(sym->is_permanent(), "only permanent symbols are cached");
+    return sym;
+  }
+#endif
   if (_lookup_shared_first) {
     sym = lookup_shared(name, len, hash);
     if (sym == nullptr) {
@@ -334,6 +349,11 @@ Symbol* SymbolTable::lookup_common(const char* name,
       }
     }
   }
+#ifndef USE_LIBRARY_BASED_TLS_ONLY
+  if (sym != nullptr && sym->is_permanent()) {
+    *cache_slot = sym;
+  }
+#endif
   return sym;
 }
 
@@ -60,6 +60,7 @@
 #include "runtime/java.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.inline.hpp"
+#include "runtime/perfData.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/vmThread.hpp"
 #include "sanitizers/leak.hpp"
@@ -1218,6 +1219,66 @@ void CodeCache::initialize() {
   // This is used on Windows 64 bit platforms to register
   // Structured Exception Handlers for our generated code.
   os::register_code_area((char*)low_bound(), (char*)high_bound());
+
+  if (UsePerfData) {
+    create_perfdata();
+  }
+}
+
+// Samples a CodeHeap statistic for PerfData. The fields are read without
+// the CodeCache_lock, which is good enough for monitoring and means that
+// polling the counters never blocks or interferes with code installation.
+class CodeHeapSampler : public PerfSampleHelper {
+ public:
+  enum Kind { free_blocks, free_bytes, unallocated_bytes };
+
+ private:
+  CodeHeap* const _heap;
+  const Kind      _kind;
+
+ public:
+  CodeHeapSampler(CodeHeap* heap, Kind kind) : _heap(heap), _kind(kind) {}
+
+  jlong take_sample() {
+    switch (_kind) {
+      case free_blocks:       return _heap->freelist_length();
+      case free_bytes:        return (jlong)_heap->allocated_in_freelist();
+      case unallocated_bytes: return (jlong)_heap->unallocated_capacity();
+    }
+    ShouldNotReachHere();
+    return 0;
+  }
+};
+
+static const char* perf_name_for(CodeBlobType code_blob_type) {
+  switch (code_blob_type) {
+    case CodeBlobType::MethodNonProfiled: return "nonProfiled";
+    case CodeBlobType::MethodProfiled:    return "profiled";
+    case CodeBlobType::NonNMethod:        return "nonNMethod";
+    case CodeBlobType::All:               return "all";
+    default:
+      ShouldNotReachHere();
+      return nullptr;
+  }
+}
+
+// Creates sun.ci.codeHeap.<heap>.{freeBlocks,freeBytes,unallocatedBytes}
+// for every code heap. They are refreshed by the StatSampler.
+void CodeCache::create_perfdata() {
+  EXCEPTION_MARK;
+  FOR_ALL_HEAPS(heap) {
+    const char* heap_name = perf_name_for((*heap)->code_blob_type());
+    char name[64];
+    jio_snprintf(name, sizeof(name), "codeHeap.%s.freeBlocks", heap_name);
+    PerfDataManager::create_variable(SUN_CI, name, PerfData::U_Events,
+                                     new CodeHeapSampler(*heap, CodeHeapSampler::free_blocks), CHECK);
+    jio_snprintf(name, sizeof(name), "codeHeap.%s.freeBytes", heap_name);
+    PerfDataManager::create_variable(SUN_CI, name, PerfData::U_Bytes,
+                                     new CodeHeapSampler(*heap, CodeHeapSampler::free_bytes), CHECK);
+    jio_snprintf(name, sizeof(name), "codeHeap.%s.unallocatedBytes", heap_name);
+    PerfDataManager::create_variable(SUN_CI, name, PerfData::U_Bytes,
+                                     new CodeHeapSampler(*heap, CodeHeapSampler::unallocated_bytes), CHECK);
+  }
 }
 
 void codeCache_init() {
@@ -216,10 +216,12 @@ address CompiledMethod::handler_for_exception_and_pc(Handle exception, address p
   // We never grab a lock to read the exception cache, so we may
   // have false negatives. This is okay, as it can only happen during
   // the first few exception lookups for a given nmethod.
+  // Decode the exception klass once rather than for every cache block.
+  Klass* exception_klass = exception->klass();
   ExceptionCache* ec = exception_cache_acquire();
   while (ec != nullptr) {
     address ret_val;
-    if ((ret_val = ec->match(exception,pc)) != nullptr) {
+    if ((ret_val = ec->match(exception_klass, pc)) != nullptr) {
       return ret_val;
     }
     ec = ec->next();
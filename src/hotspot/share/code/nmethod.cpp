@@ -281,10 +281,10 @@ ExceptionCache::ExceptionCache(Handle exception, address pc, address handler) {
 }
 
 
-address ExceptionCache::match(Handle exception, address pc) {
+address ExceptionCache::match(Klass* exception_klass, address pc) {
   assert(pc != nullptr,"Must be non null");
-  assert(exception.not_null(),"Must be non null");
-  if (exception->klass() == exception_type()) {
+  assert(exception_klass != nullptr,"Must be non null");
+  if (exception_klass == exception_type()) {
     return (test_address(pc));
   }
 
@@ -23,17 +23,20 @@
  */
 
 #include "precompiled.hpp"
+#include "code/codeCache.hpp"
 #include "code/scopeDesc.hpp"
 #include "compiler/compilationPolicy.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerDefinitions.inline.hpp"
 #include "compiler/compilerOracle.hpp"
+#include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/methodData.hpp"
 #include "oops/method.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/frame.hpp"
 #include "runtime/frame.inline.hpp"
@@ -55,6 +58,9 @@ jlong CompilationPolicy::_start_time = 0;
 int CompilationPolicy::_c1_count = 0;
 int CompilationPolicy::_c2_count = 0;
 double CompilationPolicy::_increase_threshold_at_ratio = 0;
+volatile double CompilationPolicy::_compile_ms_per_byte[CompLevel_full_optimization] = { 0 };
+bool CompilationPolicy::_compile_time_sampled[CompLevel_full_optimization] = { false };
+GrowableArrayCHeap<char*, mtCompiler>* CompilationPolicy::_hot_methods = nullptr;
 
 void compilationPolicy_init() {
   CompilationPolicy::initialize();
@@ -497,11 +503,138 @@ void CompilationPolicy::initialize() {
     }
     assert(count == c1_count() + c2_count(), "inconsistent compiler thread count");
     set_increase_threshold_at_ratio();
+    if (HotMethodsFile != nullptr) {
+      load_hot_methods(HotMethodsFile);
+    }
   }
   set_start_time(nanos_to_millis(os::javaTimeNanos()));
 }
 
 
+static int compare_hot_method_names(char** a, char** b) {
+  return strcmp(*a, *b);
+}
+
+static int compare_hot_method_name(char* const& key, char* const& elem) {
+  return strcmp(key, elem);
+}
+
+// Longest entry, including the terminating nul, that load_hot_methods() reads
+// and dump_hot_methods() writes.
+static const size_t hot_method_name_max = 1024;
+
+// Read the list of methods written by dump_hot_methods() in a previous run.
+// Each line holds one method in the Method::name_and_sig_as_C_string() format.
+void CompilationPolicy::load_hot_methods(const char* path) {
+  FILE* stream = os::fopen(path, "rt");
+  if (stream == nullptr) {
+    log_warning(jit, compilation)("Cannot open hot methods file %s", path);
+    return;
+  }
+  _hot_methods = new GrowableArrayCHeap<char*, mtCompiler>(256);
+  char line[hot_method_name_max + 1];  // and the newline
+  while (fgets(line, sizeof(line), stream) != nullptr) {
+    size_t len = strcspn(line, "\r\n");
+    if (len >= hot_method_name_max) {
+      // The line did not fit, skip the rest of it rather than reading
+      // the pieces as separate entries.
+      log_warning(jit, compilation)("Skipping overlong line in hot methods file %s", path);
+      if (line[len] == '\0') {
+        int c;
+        while ((c = fgetc(stream)) != EOF && c != '\n') {}
+      }
+      continue;
+    }
+    if (len == 0 || line[0] == '#') {
+      continue;
+    }
+    line[len] = '\0';
+    _hot_methods->append(os::strdup_check_oom(line, mtCompiler));
+  }
+  fclose(stream);
+  _hot_methods->sort(compare_hot_method_names);
+  log_info(jit, compilation)("Loaded %d hot methods from %s", _hot_methods->length(), path);
+}
+
+// Called when a class is linked: flag the methods that were compiled at the
+// highest level in the run that produced HotMethodsFile, so that the policy
+// only needs to test a bit.
+void CompilationPolicy::mark_hot_methods(InstanceKlass* ik) {
+  if (_hot_methods == nullptr || _hot_methods->is_empty() || ik->is_hidden()) {
+    return;
+  }
+  Array<Method*>* methods = ik->methods();
+  for (int i = 0; i < methods->length(); i++) {
+    ResourceMark rm;
+    Method* m = methods->at(i);
+    // Not truncated, so that a long name cannot match a shorter entry.
+    char* name = m->name_and_sig_as_C_string();
+    bool found = false;
+    _hot_methods->find_sorted<char*, compare_hot_method_name>(name, found);
+    if (found) {
+      m->set_is_hot_in_previous_run();
+      log_debug(jit, compilation)("Hot method from previous run: %s", name);
+    }
+  }
+}
+
+// Write the methods that currently have a C2 (or JVMCI) compiled version,
+// so that the next run can compile them at the highest level without
+// collecting a full profile first.
+void CompilationPolicy::dump_hot_methods(const char* path) {
+  ResourceMark rm;
+  // Only collect the names while holding CodeCache_lock. The symbols are
+  // kept alive for the formatting and I/O done after releasing it.
+  struct HotMethodName {
+    Symbol* _klass_name;
+    Symbol* _name;
+    Symbol* _signature;
+  };
+  GrowableArray<HotMethodName> names;
+  {
+    MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    NMethodIterator iter(NMethodIterator::only_not_unloading);
+    while (iter.next()) {
+      nmethod* nm = iter.method();
+      Method* m = nm->method();
+      if (nm->is_in_use() && !nm->is_osr_method() && nm->comp_level() == CompLevel_full_optimization &&
+          !m->method_holder()->is_hidden()) {
+        HotMethodName n = { m->klass_name(), m->name(), m->signature() };
+        n._klass_name->increment_refcount();
+        n._name->increment_refcount();
+        n._signature->increment_refcount();
+        names.append(n);
+      }
+    }
+  }
+
+  fileStream out(path, "w");
+  if (!out.is_open()) {
+    log_warning(jit, compilation)("Cannot open hot methods file %s for writing", path);
+  }
+  int written = 0;
+  for (int i = 0; i < names.length(); i++) {
+    HotMethodName& n = names.at(i);
+    if (out.is_open()) {
+      // Same format as Method::name_and_sig_as_C_string()
+      const char* klass_name = n._klass_name->as_klass_external_name();
+      const char* name = n._name->as_C_string();
+      const char* signature = n._signature->as_C_string();
+      // Entries load_hot_methods() would skip are not written at all.
+      if (strlen(klass_name) + 1 + strlen(name) + strlen(signature) < hot_method_name_max) {
+        out.print_cr("%s.%s%s", klass_name, name, signature);
+        written++;
+      }
+    }
+    n._klass_name->decrement_refcount();
+    n._name->decrement_refcount();
+    n._signature->decrement_refcount();
+  }
+  if (out.is_open()) {
+    log_info(jit, compilation)("Dumped %d hot methods to %s", written, path);
+  }
+}
+
 #ifdef ASSERT
 bool CompilationPolicy::verify_level(CompLevel level) {
   if (TieredCompilation && level > TieredStopAtLevel) {
@@ -646,14 +779,22 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
       continue;
     }
     update_rate(t, mh);
-    if (max_task == nullptr || compare_methods(method, max_method)) {
+    if (CompileQueueOrderByBenefit) {
+      // Select a task with the highest rate per estimated compilation time
+      if (max_task == nullptr || compare_tasks(task, max_task)) {
+        max_task = task;
+        max_method = method;
+      }
+    } else if (max_task == nullptr || compare_methods(method, max_method)) {
       // Select a method with the highest rate
       max_task = task;
       max_method = method;
     }
 
     if (task->is_blocking()) {
-      if (max_blocking_task == nullptr || compare_methods(method, max_blocking_task->method())) {
+      if (max_blocking_task == nullptr ||
+          (CompileQueueOrderByBenefit ? compare_tasks(task, max_blocking_task)
+                                      : compare_methods(method, max_blocking_task->method()))) {
         max_blocking_task = task;
       }
     }
@@ -806,6 +947,11 @@ void CompilationPolicy::compile(const methodHandle& mh, int bci, CompLevel level
     if (PrintTieredEvents) {
       print_event(COMPILE, mh(), mh(), bci, level);
     }
+    if (level == CompLevel_full_optimization && bci == InvocationEntryBci && mh->is_hot_in_previous_run()) {
+      // HotMethodsFile only skips the profiled tier for the first C2 compile.
+      // After a deoptimization the method is profiled as usual.
+      mh->set_is_hot_in_previous_run(false);
+    }
     int hot_count = (bci == InvocationEntryBci) ? mh->invocation_count() : mh->backedge_count();
     update_rate(nanos_to_millis(os::javaTimeNanos()), mh);
     CompileBroker::compile_method(mh, bci, level, mh, hot_count, CompileTask::Reason_Tiered, THREAD);
@@ -891,6 +1037,44 @@ bool CompilationPolicy::compare_methods(Method* x, Method* y) {
   return false;
 }
 
+double CompilationPolicy::compile_cost(CompileTask* task) {
+  int level = task->comp_level();
+  assert(level > CompLevel_none && level <= CompLevel_full_optimization, "invalid level %d", level);
+  // Written under CompileStatistics_lock, but read here with only the
+  // MethodCompileQueue_lock held; the atomic load keeps the read untorn.
+  return 1.0 + Atomic::load(&_compile_ms_per_byte[level - 1]) * task->method()->code_size();
+}
+
+bool CompilationPolicy::compare_tasks(CompileTask* x, CompileTask* y) {
+  Method* mx = x->method();
+  Method* my = y->method();
+  if (mx->highest_comp_level() != my->highest_comp_level()) {
+    // Recompilation after deopt goes first
+    return mx->highest_comp_level() > my->highest_comp_level();
+  }
+  return weight(mx) / compile_cost(x) > weight(my) / compile_cost(y);
+}
+
+void CompilationPolicy::record_compile_time(int comp_level, int code_size, double time_ms) {
+  assert_lock_strong(CompileStatistics_lock);
+  if (comp_level <= CompLevel_none || comp_level > CompLevel_full_optimization || code_size <= 0) {
+    return;
+  }
+  // Exponentially decaying average, so that the estimate follows the workload.
+  // The first sample for a level seeds the average.
+  const double alpha = 0.1;
+  const int idx = comp_level - 1;
+  double sample = time_ms / code_size;
+  double avg = Atomic::load(&_compile_ms_per_byte[idx]);
+  if (_compile_time_sampled[idx]) {
+    avg = (1.0 - alpha) * avg + alpha * sample;
+  } else {
+    avg = sample;
+    _compile_time_sampled[idx] = true;
+  }
+  Atomic::store(&_compile_ms_per_byte[idx], avg);
+}
+
 // Is method profiled enough?
 bool CompilationPolicy::is_method_profiled(const methodHandle& method) {
   MethodData* mdo = method->method_data();
@@ -1043,7 +1227,14 @@ CompLevel CompilationPolicy::common(const methodHandle& method, CompLevel cur_le
           // we introduce a feedback on the C2 queue size. If the C2 queue is sufficiently long
           // we choose to compile a limited profiled version and then recompile with full profiling
           // when the load on C2 goes down.
-          if (!disable_feedback && CompileBroker::queue_size(CompLevel_full_optimization) >
+          // A method that reached C2 in a previous run does not need to go
+          // through the profiled tier again (see HotMethodsFile). C2 then
+          // compiles it with whatever profile the interpreter collected,
+          // which is usually none, so the code can be less optimized.
+          // compile() clears the flag, so recompilations are profiled.
+          if (method->is_hot_in_previous_run()) {
+            next_level = CompLevel_full_optimization;
+          } else if (!disable_feedback && CompileBroker::queue_size(CompLevel_full_optimization) >
               Tier3DelayOn * compiler_count(CompLevel_full_optimization)) {
             next_level = CompLevel_limited_profile;
           } else {
@@ -29,6 +29,7 @@
 #include "compiler/compileBroker.hpp"
 #include "oops/methodData.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/growableArray.hpp"
 
 class CompileTask;
 class CompileQueue;
@@ -176,6 +177,11 @@ class CompilationPolicy : AllStatic {
   static jlong _start_time;
   static int _c1_count, _c2_count;
   static double _increase_threshold_at_ratio;
+  // Average observed compilation time in milliseconds per bytecode byte,
+  // per compilation level, and whether a level has been sampled yet.
+  // Both are written under CompileStatistics_lock.
+  static volatile double _compile_ms_per_byte[CompLevel_full_optimization];
+  static bool _compile_time_sampled[CompLevel_full_optimization];
 
   // Set carry flags in the counters (in Method* and MDO).
   inline static void handle_counter_overflow(const methodHandle& method);
@@ -205,6 +211,14 @@ class CompilationPolicy : AllStatic {
   inline static double weight(Method* method);
   // Apply heuristics and return true if x should be compiled before y
   inline static bool compare_methods(Method* x, Method* y);
+  // Estimated time in milliseconds to compile the task, based on the
+  // compilation times observed so far for its level.
+  static double compile_cost(CompileTask* task);
+  // Return true if x gives more benefit per estimated compilation time than y
+  static bool compare_tasks(CompileTask* x, CompileTask* y);
+  // Methods read from HotMethodsFile, sorted by name and signature
+  static GrowableArrayCHeap<char*, mtCompiler>* _hot_methods;
+  static void load_hot_methods(const char* path);
   // Compute event rate for a given method. The rate is the number of event (invocations + backedges)
   // per millisecond.
   inline static void update_rate(jlong t, const methodHandle& method);
@@ -262,8 +276,14 @@ class CompilationPolicy : AllStatic {
   static bool is_compilation_enabled();
 
   static CompileTask* select_task_helper(CompileQueue* compile_queue);
+  // Record the time a successful compilation took, for compile_cost().
+  static void record_compile_time(int comp_level, int code_size, double time_ms);
   // Return initial compile level to use with Xcomp (depends on compilation mode).
   static void reprofile(ScopeDesc* trap_scope, bool is_osr);
+  // Flag the methods of a class being linked that are listed in HotMethodsFile
+  static void mark_hot_methods(InstanceKlass* ik);
+  // Write the methods with a full optimization compiled version to path
+  static void dump_hot_methods(const char* path);
   static nmethod* event(const methodHandle& method, const methodHandle& inlinee,
                  int branch_bci, int bci, CompLevel comp_level, CompiledMethod* nm, TRAPS);
   // Select task is called by CompileBroker. We should return a task or nullptr.
@@ -1015,12 +1015,16 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
   // Only do attempt to start additional threads if the lock is free.
   if (!CompileThread_lock->try_lock()) return;
 
+  // The active processor count follows container CPU quota changes, so
+  // re-read it on every attempt.
+  int cpu_limit = MAX2(1, (int)(os::active_processor_count() * DynamicCompilerThreadsCPUPercentage / 100));
+
   if (_c2_compile_queue != nullptr) {
     int old_c2_count = _compilers[1]->num_compiler_threads();
-    int new_c2_count = MIN4(_c2_count,
+    int new_c2_count = MIN2(cpu_limit, MIN4(_c2_count,
         _c2_compile_queue->size() / 2,
         (int)(free_memory / (200*M)),
-        (int)(available_cc_np / (128*K)));
+        (int)(available_cc_np / (128*K))));
 
     for (int i = old_c2_count; i < new_c2_count; i++) {
 #if INCLUDE_JVMCI
@@ -1075,10 +1079,10 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   if (_c1_compile_queue != nullptr) {
     int old_c1_count = _compilers[0]->num_compiler_threads();
-    int new_c1_count = MIN4(_c1_count,
+    int new_c1_count = MIN2(cpu_limit, MIN4(_c1_count,
         _c1_compile_queue->size() / 4,
         (int)(free_memory / (100*M)),
-        (int)(available_cc_p / (128*K)));
+        (int)(available_cc_p / (128*K))));
 
     for (int i = old_c1_count; i < new_c1_count; i++) {
       JavaThread *ct = make_thread(compiler_t, compiler1_object(i), _c1_compile_queue, _compilers[0], THREAD);
@@ -2516,6 +2520,10 @@ void CompileBroker::collect_statistics(CompilerThread* thread, elapsedTimer time
     _perf_total_compilation->inc(time.ticks());
     _peak_compilation_time = time.milliseconds() > _peak_compilation_time ? time.milliseconds() : _peak_compilation_time;
 
+    if (CompileQueueOrderByBenefit) {
+      CompilationPolicy::record_compile_time(comp_level, method->code_size(), time.seconds() * 1000.0);
+    }
+
     if (CITime) {
       int bytes_compiled = method->code_size() + task->num_inlined_bytecodes();
       if (is_osr) {
@@ -270,6 +270,20 @@
           "Maximum rate sampling interval (in milliseconds)")               \
           range(0, max_intx)                                                \
                                                                             \
+  product(bool, CompileQueueOrderByBenefit, false, EXPERIMENTAL,            \
+          "Select the next compile task by its event rate per estimated "   \
+          "compilation time, using the compilation times observed for "     \
+          "each compilation level")                                         \
+                                                                            \
+  product(ccstr, DumpHotMethodsAtExit, nullptr, EXPERIMENTAL,               \
+          "At exit, write the methods that have a full optimization "       \
+          "compiled version to this file")                                  \
+                                                                            \
+  product(ccstr, HotMethodsFile, nullptr, EXPERIMENTAL,                     \
+          "Read methods written by DumpHotMethodsAtExit from this file "    \
+          "and compile them at full optimization without profiling them "   \
+          "in tier 3 first")                                                \
+                                                                            \
   product(ccstr, CompilationMode, "default",                                \
           "Compilation modes: "                                             \
           "default: normal tiered compilation; "                            \
@@ -50,6 +50,23 @@ class G1CardTable : public CardTable {
 
   G1CardTableChangedListener _listener;
 
+  // Number of words combined per step when searching for cards to scan. Testing
+  // several words at once allows the compiler to use wide vector loads and
+  // keeps the number of branches low on long runs of uniform cards.
+  static const size_t ScanBlockWords = 4;
+
+  // Returns whether the card matches the search for cards to scan (ToScan) or
+  // not to scan.
+  template <bool ToScan>
+  static inline bool card_matches(CardValue value);
+  // Returns a word with the g1_card_already_scanned bit of every card of value
+  // set that matches the search.
+  template <bool ToScan>
+  static inline size_t matching_cards_in_word(size_t value);
+
+  template <bool ToScan>
+  static inline CardValue* find_first_matching_card(CardValue* start_card, CardValue* end_card);
+
 public:
   enum G1CardValues {
     g1_young_gen = CT_MR_BS_last_reserved << 1,
@@ -107,6 +124,12 @@ class G1CardTable : public CardTable {
 
   inline uint region_idx_for(CardValue* p);
 
+  // Search [start_card, end_card) for the first card that needs to be scanned
+  // during evacuation, i.e. has the g1_card_already_scanned bit cleared, or for
+  // the first card that does not. Returns end_card if there is no such card.
+  static inline CardValue* find_first_card_to_scan(CardValue* start_card, CardValue* end_card);
+  static inline CardValue* find_first_card_not_to_scan(CardValue* start_card, CardValue* end_card);
+
   static size_t compute_size(size_t mem_region_size_in_words) {
     size_t number_of_slots = (mem_region_size_in_words / _card_size_in_words);
     return ReservedSpace::allocation_align_size_up(number_of_slots);
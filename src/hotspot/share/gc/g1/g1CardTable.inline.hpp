@@ -28,6 +28,8 @@
 #include "gc/g1/g1CardTable.hpp"
 
 #include "gc/g1/heapRegion.hpp"
+#include "utilities/count_leading_zeros.hpp"
+#include "utilities/count_trailing_zeros.hpp"
 
 inline uint G1CardTable::region_idx_for(CardValue* p) {
   size_t const card_idx = pointer_delta(p, _byte_map, sizeof(CardValue));
@@ -81,4 +83,66 @@ inline void G1CardTable::change_dirty_cards_to(CardValue* start_card, CardValue*
   }
 }
 
+template <bool ToScan>
+inline bool G1CardTable::card_matches(CardValue value) {
+  return ((value & g1_card_already_scanned) == 0) == ToScan;
+}
+
+template <bool ToScan>
+inline size_t G1CardTable::matching_cards_in_word(size_t value) {
+  return (ToScan ? ~value : value) & WordAlreadyScanned;
+}
+
+template <bool ToScan>
+inline CardTable::CardValue* G1CardTable::find_first_matching_card(CardValue* start_card, CardValue* end_card) {
+  CardValue* i_card = start_card;
+  while (i_card < end_card && !is_aligned(i_card, sizeof(size_t))) {
+    if (card_matches<ToScan>(*i_card)) {
+      return i_card;
+    }
+    i_card++;
+  }
+
+  const size_t* cur_word = reinterpret_cast<const size_t*>(i_card);
+  const size_t* const end_word = reinterpret_cast<const size_t*>(align_down(end_card, sizeof(size_t)));
+
+  // Skip blocks of words without any matching card. A card to scan has its
+  // bit cleared, so a single cleared bit survives and-ing the block; a card not
+  // to scan has it set, which survives or-ing.
+  while (cur_word < end_word && pointer_delta(end_word, cur_word, sizeof(size_t)) >= ScanBlockWords) {
+    size_t combined = cur_word[0];
+    for (size_t i = 1; i < ScanBlockWords; i++) {
+      combined = ToScan ? (combined & cur_word[i]) : (combined | cur_word[i]);
+    }
+    if (matching_cards_in_word<ToScan>(combined) != 0) {
+      break;
+    }
+    cur_word += ScanBlockWords;
+  }
+
+  for (/* empty */; cur_word < end_word; cur_word++) {
+    size_t matching = matching_cards_in_word<ToScan>(*cur_word);
+    if (matching != 0) {
+      size_t bit = LITTLE_ENDIAN_ONLY(count_trailing_zeros(matching))
+                   BIG_ENDIAN_ONLY(count_leading_zeros(matching));
+      return (CardValue*)cur_word + bit / BitsPerByte;
+    }
+  }
+
+  for (i_card = (CardValue*)MAX2(cur_word, end_word); i_card < end_card; i_card++) {
+    if (card_matches<ToScan>(*i_card)) {
+      return i_card;
+    }
+  }
+  return end_card;
+}
+
+inline CardTable::CardValue* G1CardTable::find_first_card_to_scan(CardValue* start_card, CardValue* end_card) {
+  return find_first_matching_card<true>(start_card, end_card);
+}
+
+inline CardTable::CardValue* G1CardTable::find_first_card_not_to_scan(CardValue* start_card, CardValue* end_card) {
+  return find_first_matching_card<false>(start_card, end_card);
+}
+
 #endif /* SHARE_GC_G1_G1CARDTABLE_INLINE_HPP */
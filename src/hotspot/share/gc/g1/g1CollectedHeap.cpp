@@ -1285,6 +1285,10 @@ G1CollectedHeap::G1CollectedHeap() :
     _task_queues->register_queue(i, q);
   }
 
+  if (G1NUMAAwareStealing && _numa->is_enabled()) {
+    _task_queues->enable_node_aware_stealing();
+  }
+
   _gc_tracer_stw->initialize();
 
   guarantee(_task_queues != nullptr, "task_queues allocation failure.");
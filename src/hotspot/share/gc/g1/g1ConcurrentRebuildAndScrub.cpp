@@ -28,6 +28,8 @@
 
 #include "gc/g1/g1ConcurrentMark.inline.hpp"
 #include "gc/g1/g1ConcurrentMarkBitMap.inline.hpp"
+#include "gc/g1/g1Policy.hpp"
+#include "gc/g1/g1RemSetTrackingPolicy.hpp"
 #include "gc/g1/g1_globals.hpp"
 #include "gc/g1/heapRegion.inline.hpp"
 #include "gc/g1/heapRegionManager.inline.hpp"
@@ -36,8 +38,10 @@
 #include "logging/log.hpp"
 #include "memory/memRegion.hpp"
 #include "oops/oopsHierarchy.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/quickSort.hpp"
 
 // Worker task that scans the objects in the old generation to rebuild the remembered
 // set and at the same time scrubs dead objects by replacing them with filler objects
@@ -67,6 +71,54 @@ class G1RebuildRSAndScrubTask : public WorkerTask {
 
   const bool _should_rebuild_remset;
 
+  // If G1RebuildRemSetLargestRegionsFirst is set, the regions to process in the
+  // order they are claimed by the workers; otherwise null and the workers claim
+  // regions using _hr_claimer.
+  struct RegionWork {
+    uint _region_idx;
+    size_t _work;
+  };
+  RegionWork* _region_order;
+  uint _num_ordered_regions;
+  volatile uint _next_ordered_region;
+
+  static int compare_region_work(RegionWork a, RegionWork b) {
+    // Descending by work; ties are broken by region index to keep the order stable.
+    if (a._work != b._work) {
+      return a._work > b._work ? -1 : 1;
+    }
+    return static_cast<int>(a._region_idx) - static_cast<int>(b._region_idx);
+  }
+
+  void initialize_region_order() {
+    // Prevent regions being freed by a collection while computing the estimates.
+    SuspendibleThreadSetJoiner sts_join;
+
+    G1CollectedHeap* g1h = G1CollectedHeap::heap();
+    G1RemSetTrackingPolicy* tracker = g1h->policy()->remset_tracker();
+    uint max_regions = g1h->max_reserved_regions();
+
+    _region_order = NEW_C_HEAP_ARRAY(RegionWork, max_regions, mtGC);
+    size_t total_work = 0;
+    for (uint i = 0; i < max_regions; i++) {
+      HeapRegion* hr = g1h->region_at_or_null(i);
+      if (hr == nullptr || _cm->top_at_rebuild_start(i) == nullptr) {
+        continue;
+      }
+      size_t work = tracker->rebuild_work_estimate(hr);
+      _region_order[_num_ordered_regions++] = { i, work };
+      total_work += work;
+    }
+    QuickSort::sort(_region_order, _num_ordered_regions, compare_region_work, false);
+
+    log_debug(gc, marking)("Rebuild and scrub order: %u regions, estimated work " SIZE_FORMAT "%s, largest region " SIZE_FORMAT "%s",
+                           _num_ordered_regions,
+                           byte_size_in_proper_unit(total_work * HeapWordSize),
+                           proper_unit_for_byte_size(total_work * HeapWordSize),
+                           byte_size_in_proper_unit(_num_ordered_regions > 0 ? _region_order[0]._work * HeapWordSize : 0),
+                           proper_unit_for_byte_size(_num_ordered_regions > 0 ? _region_order[0]._work * HeapWordSize : 0));
+  }
+
   class G1RebuildRSAndScrubRegionClosure : public HeapRegionClosure {
     G1ConcurrentMark* _cm;
     const G1CMBitMap* _bitmap;
@@ -331,14 +383,39 @@ class G1RebuildRSAndScrubTask : public WorkerTask {
     WorkerTask("Scrub dead objects"),
     _cm(cm),
     _hr_claimer(num_workers),
-    _should_rebuild_remset(should_rebuild_remset) { }
+    _should_rebuild_remset(should_rebuild_remset),
+    _region_order(nullptr),
+    _num_ordered_regions(0),
+    _next_ordered_region(0) {
+    if (G1RebuildRemSetLargestRegionsFirst) {
+      initialize_region_order();
+    }
+  }
+
+  ~G1RebuildRSAndScrubTask() {
+    FREE_C_HEAP_ARRAY(RegionWork, _region_order);
+  }
 
   void work(uint worker_id) {
     SuspendibleThreadSetJoiner sts_join;
 
     G1CollectedHeap* g1h = G1CollectedHeap::heap();
     G1RebuildRSAndScrubRegionClosure cl(_cm, _should_rebuild_remset, worker_id);
-    g1h->heap_region_par_iterate_from_worker_offset(&cl, &_hr_claimer, worker_id);
+    if (_region_order == nullptr) {
+      g1h->heap_region_par_iterate_from_worker_offset(&cl, &_hr_claimer, worker_id);
+      return;
+    }
+
+    uint claimed;
+    while ((claimed = Atomic::fetch_then_add(&_next_ordered_region, 1u)) < _num_ordered_regions) {
+      // The region may have been uncommitted in the meantime; do_heap_region()
+      // itself handles regions that have been reclaimed.
+      HeapRegion* hr = g1h->region_at_or_null(_region_order[claimed]._region_idx);
+      if (hr != nullptr && cl.do_heap_region(hr)) {
+        // Marking has been aborted.
+        return;
+      }
+    }
   }
 };
 
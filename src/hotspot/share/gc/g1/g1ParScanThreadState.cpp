@@ -321,6 +321,10 @@ void G1ParScanThreadState::trim_queue_to_threshold(uint threshold) {
 ATTRIBUTE_FLATTEN
 void G1ParScanThreadState::steal_and_trim_queue(G1ScannerTasksQueueSet* task_queues) {
   ScannerTask stolen_task;
+  if (task_queues->is_node_aware()) {
+    // Workers may migrate between nodes; refresh before stealing.
+    task_queues->set_queue_node_index(_worker_id, _numa->index_of_current_thread());
+  }
   while (task_queues->steal(_worker_id, stolen_task)) {
     dispatch_task(stolen_task);
     // Processing stolen task may have added tasks to our queue.
@@ -566,81 +566,21 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
 
   // To locate consecutive dirty cards inside a chunk.
   class ChunkScanner {
-    using Word = size_t;
-
     CardValue* const _start_card;
     CardValue* const _end_card;
 
-    static const size_t ExpandedToScanMask = G1CardTable::WordAlreadyScanned;
-    static const size_t ToScanMask = G1CardTable::g1_card_already_scanned;
-
-    static bool is_card_dirty(const CardValue* const card) {
-      return (*card & ToScanMask) == 0;
-    }
-
-    static bool is_word_aligned(const void* const addr) {
-      return ((uintptr_t)addr) % sizeof(Word) == 0;
-    }
-
     CardValue* find_first_dirty_card(CardValue* i_card) const {
-      while (!is_word_aligned(i_card)) {
-        if (is_card_dirty(i_card)) {
-          return i_card;
-        }
-        i_card++;
-      }
-
-      for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
-        Word word_value = *reinterpret_cast<Word*>(i_card);
-        bool has_dirty_cards_in_word = (~word_value & ExpandedToScanMask) != 0;
-
-        if (has_dirty_cards_in_word) {
-          for (uint i = 0; i < sizeof(Word); ++i) {
-            if (is_card_dirty(i_card)) {
-              return i_card;
-            }
-            i_card++;
-          }
-          assert(false, "should have early-returned");
-        }
-      }
-
-      return _end_card;
+      return G1CardTable::find_first_card_to_scan(i_card, _end_card);
     }
 
     CardValue* find_first_non_dirty_card(CardValue* i_card) const {
-      while (!is_word_aligned(i_card)) {
-        if (!is_card_dirty(i_card)) {
-          return i_card;
-        }
-        i_card++;
-      }
-
-      for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
-        Word word_value = *reinterpret_cast<Word*>(i_card);
-        bool all_cards_dirty = (word_value == G1CardTable::WordAllDirty);
-
-        if (!all_cards_dirty) {
-          for (uint i = 0; i < sizeof(Word); ++i) {
-            if (!is_card_dirty(i_card)) {
-              return i_card;
-            }
-            i_card++;
-          }
-          assert(false, "should have early-returned");
-        }
-      }
-
-      return _end_card;
+      return G1CardTable::find_first_card_not_to_scan(i_card, _end_card);
     }
 
   public:
     ChunkScanner(CardValue* const start_card, CardValue* const end_card) :
       _start_card(start_card),
-      _end_card(end_card) {
-        assert(is_word_aligned(start_card), "precondition");
-        assert(is_word_aligned(end_card), "precondition");
-      }
+      _end_card(end_card) {}
 
     template<typename Func>
     void on_dirty_cards(Func&& f) {
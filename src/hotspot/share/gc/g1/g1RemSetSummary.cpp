@@ -29,6 +29,7 @@
 #include "gc/g1/g1ConcurrentRefine.hpp"
 #include "gc/g1/g1ConcurrentRefineThread.hpp"
 #include "gc/g1/g1DirtyCardQueue.hpp"
+#include "gc/g1/g1MonotonicArenaFreePool.hpp"
 #include "gc/g1/g1RemSet.hpp"
 #include "gc/g1/g1RemSetSummary.hpp"
 #include "gc/g1/heapRegion.hpp"
@@ -208,6 +209,24 @@ class HRRSStatsIter: public HeapRegionClosure {
   size_t max_code_root_mem_sz() const       { return _max_code_root_mem_sz; }
   HeapRegion* max_code_root_mem_sz_region() const { return _max_code_root_mem_sz_region; }
 
+  // Card set memory per memory object (container) type.
+  G1MonotonicArenaMemoryStats _card_set_mem_stats;
+
+  void print_card_set_mem_stats_on(outputStream* out) {
+    size_t total = 0;
+    for (uint i = 0; i < _card_set_mem_stats.num_pools(); i++) {
+      total += _card_set_mem_stats._num_mem_sizes[i];
+    }
+    out->print_cr("  Card set container memory = " SIZE_FORMAT, total);
+    for (uint i = 0; i < _card_set_mem_stats.num_pools(); i++) {
+      size_t mem_size = _card_set_mem_stats._num_mem_sizes[i];
+      out->print_cr("    " SIZE_FORMAT_W(8) " (%5.1f%%) in " SIZE_FORMAT " segments by %s containers",
+                    mem_size, percent_of(mem_size, total),
+                    _card_set_mem_stats._num_segments[i],
+                    G1CardSetConfiguration::mem_object_type_name_str(i));
+    }
+  }
+
 public:
   HRRSStatsIter() : _young("Young"), _humongous("Humongous"),
     _free("Free"), _old("Old"), _all("All"),
@@ -250,6 +269,7 @@ class HRRSStatsIter: public HeapRegionClosure {
                  code_root_mem_sz, code_root_elems, r->rem_set()->is_tracked());
     _all.add(rs_unused_mem_sz, rs_mem_sz, occupied_cards,
              code_root_mem_sz, code_root_elems, r->rem_set()->is_tracked());
+    _card_set_mem_stats.add(hrrs->card_set_memory_stats());
 
     return false;
   }
@@ -281,6 +301,8 @@ class HRRSStatsIter: public HeapRegionClosure {
                   rem_set->mem_size(),
                   rem_set->occupied());
 
+    print_card_set_mem_stats_on(out);
+
     HeapRegionRemSet::print_static_mem_size(out);
     G1CollectedHeap* g1h = G1CollectedHeap::heap();
     g1h->card_set_freelist_pool()->print_on(out);
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "gc/g1/g1CollectionSetChooser.hpp"
+#include "gc/g1/g1ConcurrentMark.inline.hpp"
 #include "gc/g1/g1RemSetTrackingPolicy.hpp"
 #include "gc/g1/heapRegion.inline.hpp"
 #include "gc/g1/heapRegionRemSet.inline.hpp"
@@ -37,6 +38,23 @@ bool G1RemSetTrackingPolicy::needs_scan_for_rebuild(HeapRegion* r) const {
   return !(r->is_young() || r->is_free());
 }
 
+size_t G1RemSetTrackingPolicy::rebuild_work_estimate(HeapRegion* r) const {
+  G1ConcurrentMark* cm = G1CollectedHeap::heap()->concurrent_mark();
+  HeapWord* tars = cm->top_at_rebuild_start(r->hrm_index());
+  if (tars == nullptr) {
+    // Nothing to scan or scrub.
+    return 0;
+  }
+  if (r->is_humongous()) {
+    // The whole object is live and scanned in chunks.
+    return pointer_delta(tars, r->bottom());
+  }
+  // Below parsable bottom only live objects are scanned, everything above it
+  // up to tars is live.
+  HeapWord* pb = MIN2(r->parsable_bottom_acquire(), tars);
+  return cm->live_bytes(r->hrm_index()) / HeapWordSize + pointer_delta(tars, pb);
+}
+
 void G1RemSetTrackingPolicy::update_at_allocate(HeapRegion* r) {
   if (r->is_young()) {
     // Always collect remembered set for young regions.
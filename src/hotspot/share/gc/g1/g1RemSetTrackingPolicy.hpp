@@ -37,6 +37,10 @@ class G1RemSetTrackingPolicy : public CHeapObj<mtGC> {
   // Do we need to scan the given region to get all outgoing references for remembered
   // set rebuild?
   bool needs_scan_for_rebuild(HeapRegion* r) const;
+  // Estimate of the amount of work, in words, needed to scan and scrub the given
+  // region during remembered set rebuild. Regions are handed out to the rebuild
+  // workers in decreasing order of this estimate.
+  size_t rebuild_work_estimate(HeapRegion* r) const;
   // Update remembered set tracking state at allocation of the region. May be
   // called at any time. The caller makes sure that the changes to the remembered
   // set state are visible to other threads.
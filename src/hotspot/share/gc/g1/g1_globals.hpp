@@ -275,6 +275,11 @@
           "Chunk size used for rebuilding the remembered set.")             \
           range(4 * K, 32 * M)                                              \
                                                                             \
+  product(bool, G1RebuildRemSetLargestRegionsFirst, false, EXPERIMENTAL,    \
+          "Hand out regions to the remembered set rebuild and scrub "       \
+          "workers in decreasing order of estimated work to improve load "  \
+          "balancing.")                                                     \
+                                                                            \
   product(uint, G1OldCSetRegionThresholdPercent, 10, EXPERIMENTAL,         \
           "An upper bound for the number of old CSet regions expressed "    \
           "as a percentage of the heap size.")                              \
@@ -334,6 +339,10 @@
           "scan cost related prediction samples. A sample must involve "    \
           "the same or more than this number of code roots to be used.")    \
                                                                             \
+  product(bool, G1NUMAAwareStealing, true, EXPERIMENTAL,                    \
+          "When NUMA is enabled, let evacuation workers prefer stealing "   \
+          "tasks from workers running on the same NUMA node.")              \
+                                                                            \
   GC_G1_EVACUATION_FAILURE_FLAGS(develop,                                   \
                     develop_pd,                                             \
                     product,                                                \
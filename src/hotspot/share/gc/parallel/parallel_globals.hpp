@@ -56,7 +56,11 @@
           range(0, 100)                                                     \
                                                                             \
   product(bool, PSChunkLargeArrays, true,                                   \
-          "Process large arrays in chunks")
+          "Process large arrays in chunks")                                 \
+                                                                            \
+  product(bool, ParallelCompactNUMAAwareDraining, true, EXPERIMENTAL,       \
+          "With UseNUMA, let compaction workers first fill the regions "    \
+          "located on their own NUMA node")
 
 // end of GC_PARALLEL_FLAGS
 
@@ -86,6 +86,7 @@
 #include "utilities/debug.hpp"
 #include "utilities/events.hpp"
 #include "utilities/formatBuffer.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/stack.inline.hpp"
 #if INCLUDE_JVMCI
@@ -2177,7 +2178,117 @@ class FillableRegionLogger : public StackObj {
   }
 };
 
-void PSParallelCompact::prepare_region_draining_tasks(uint parallel_gc_threads)
+// Regions that are available for filling at the start of the compaction,
+// grouped by the NUMA node of the memory they are filled into. Workers first
+// claim the regions on their own node, so that most of the copying writes go
+// to node-local memory, and then help with the regions of the other nodes.
+class FillableRegionsByNode : public CHeapObj<mtGC> {
+private:
+  typedef GrowableArrayCHeap<size_t, mtGC> RegionList;
+
+  uint _num_nodes;
+  uint* _node_ids;
+  RegionList** _regions;
+  volatile size_t* _claimed;
+
+  // Nodes are assigned page-wise, so cache the result for the last page.
+  const size_t _page_size;
+  const void* _last_page;
+  uint _last_node_index;
+
+  uint node_index_for_id(int node_id) const {
+    for (uint i = 0; i < _num_nodes; i++) {
+      if (_node_ids[i] == (uint)node_id) {
+        return i;
+      }
+    }
+    return 0;
+  }
+
+  uint node_index_for_address(HeapWord* addr) {
+    const void* page = align_down((void*)addr, _page_size);
+    if (page != _last_page) {
+      _last_page = page;
+      _last_node_index = node_index_for_id(os::numa_get_group_id_for_address(page));
+    }
+    return _last_node_index;
+  }
+
+public:
+  FillableRegionsByNode() :
+    _num_nodes(0),
+    _node_ids(nullptr),
+    _regions(nullptr),
+    _claimed(nullptr),
+    _page_size(UseLargePages ? os::large_page_size() : os::vm_page_size()),
+    _last_page(nullptr),
+    _last_node_index(0) {
+    const size_t num_groups = os::numa_get_groups_num();
+    _node_ids = NEW_C_HEAP_ARRAY(uint, num_groups, mtGC);
+    _num_nodes = (uint)os::numa_get_leaf_groups(_node_ids, num_groups);
+    if (_num_nodes == 0) {
+      _node_ids[0] = 0;
+      _num_nodes = 1;
+    }
+    _regions = NEW_C_HEAP_ARRAY(RegionList*, _num_nodes, mtGC);
+    _claimed = NEW_C_HEAP_ARRAY(volatile size_t, _num_nodes, mtGC);
+    for (uint i = 0; i < _num_nodes; i++) {
+      _regions[i] = new RegionList();
+      _claimed[i] = 0;
+    }
+  }
+
+  ~FillableRegionsByNode() {
+    for (uint i = 0; i < _num_nodes; i++) {
+      delete _regions[i];
+    }
+    FREE_C_HEAP_ARRAY(volatile size_t, _claimed);
+    FREE_C_HEAP_ARRAY(RegionList*, _regions);
+    FREE_C_HEAP_ARRAY(uint, _node_ids);
+  }
+
+  static bool should_use() {
+    return UseNUMA && ParallelCompactNUMAAwareDraining && os::numa_get_groups_num() > 1;
+  }
+
+  uint num_nodes() const { return _num_nodes; }
+
+  uint current_node_index() const {
+    return node_index_for_id(os::numa_get_group_id());
+  }
+
+  void add(size_t region_index) {
+    HeapWord* addr = PSParallelCompact::summary_data().region_to_addr(region_index);
+    _regions[node_index_for_address(addr)]->append(region_index);
+  }
+
+  // Regions are added in descending address order; hand them out in the
+  // reverse order, like the thread stacks do.
+  bool claim(uint node_index, size_t& region_index) {
+    RegionList* regions = _regions[node_index];
+    if (Atomic::load(&_claimed[node_index]) >= (size_t)regions->length()) {
+      return false;
+    }
+    size_t claimed = Atomic::fetch_then_add(&_claimed[node_index], (size_t)1);
+    if (claimed >= (size_t)regions->length()) {
+      return false;
+    }
+    region_index = regions->at(regions->length() - 1 - (int)claimed);
+    return true;
+  }
+
+  void print() const {
+    LogTarget(Debug, gc, compaction) lt;
+    if (lt.is_enabled()) {
+      for (uint i = 0; i < _num_nodes; i++) {
+        lt.print("Fillable regions on node %u: %d", _node_ids[i], _regions[i]->length());
+      }
+    }
+  }
+};
+
+void PSParallelCompact::prepare_region_draining_tasks(uint parallel_gc_threads,
+                                                      FillableRegionsByNode* regions_by_node)
 {
   GCTraceTime(Trace, gc, phases) tm("Drain Task Setup", &_gc_timer);
 
@@ -2203,11 +2314,15 @@ void PSParallelCompact::prepare_region_draining_tasks(uint parallel_gc_threads)
 
     for (size_t cur = end_region - 1; cur + 1 > beg_region; --cur) {
       if (sd.region(cur)->claim_unsafe()) {
-        ParCompactionManager* cm = ParCompactionManager::gc_thread_compaction_manager(worker_id);
         bool result = sd.region(cur)->mark_normal();
         assert(result, "Must succeed at this point.");
-        cm->region_stack()->push(cur);
+        ParCompactionManager* cm = ParCompactionManager::gc_thread_compaction_manager(worker_id);
         region_logger.handle(cur);
+        if (regions_by_node != nullptr) {
+          regions_by_node->add(cur);
+          continue;
+        }
+        cm->region_stack()->push(cur);
         // Assign regions to tasks in round-robin fashion.
         if (++worker_id == parallel_gc_threads) {
           worker_id = 0;
@@ -2216,6 +2331,10 @@ void PSParallelCompact::prepare_region_draining_tasks(uint parallel_gc_threads)
     }
     region_logger.print_line();
   }
+
+  if (regions_by_node != nullptr) {
+    regions_by_node->print();
+  }
 }
 
 class TaskQueue : StackObj {
@@ -2372,12 +2491,27 @@ void PSParallelCompact::write_block_fill_histogram()
 }
 #endif // #ifdef ASSERT
 
-static void compaction_with_stealing_work(TaskTerminator* terminator, uint worker_id) {
+static void compaction_with_stealing_work(TaskTerminator* terminator, uint worker_id,
+                                          FillableRegionsByNode* regions_by_node) {
   assert(ParallelScavengeHeap::heap()->is_gc_active(), "called outside gc");
 
   ParCompactionManager* cm =
     ParCompactionManager::gc_thread_compaction_manager(worker_id);
 
+  if (regions_by_node != nullptr) {
+    // Fill the regions on the local node first, then help with the others.
+    const uint num_nodes = regions_by_node->num_nodes();
+    const uint local = regions_by_node->current_node_index();
+    for (uint i = 0; i < num_nodes; i++) {
+      const uint node_index = (local + i) % num_nodes;
+      size_t region_index;
+      while (regions_by_node->claim(node_index, region_index)) {
+        PSParallelCompact::fill_and_update_region(cm, region_index);
+        cm->drain_region_stacks();
+      }
+    }
+  }
+
   // Drain the stacks that have been preloaded with regions
   // that are ready to fill.
 
@@ -2407,12 +2541,15 @@ static void compaction_with_stealing_work(TaskTerminator* terminator, uint worke
 class UpdateDensePrefixAndCompactionTask: public WorkerTask {
   TaskQueue& _tq;
   TaskTerminator _terminator;
+  FillableRegionsByNode* _regions_by_node;
 
 public:
-  UpdateDensePrefixAndCompactionTask(TaskQueue& tq, uint active_workers) :
+  UpdateDensePrefixAndCompactionTask(TaskQueue& tq, uint active_workers,
+                                     FillableRegionsByNode* regions_by_node) :
       WorkerTask("UpdateDensePrefixAndCompactionTask"),
       _tq(tq),
-      _terminator(active_workers, ParCompactionManager::region_task_queues()) {
+      _terminator(active_workers, ParCompactionManager::region_task_queues()),
+      _regions_by_node(regions_by_node) {
   }
   virtual void work(uint worker_id) {
     ParCompactionManager* cm = ParCompactionManager::gc_thread_compaction_manager(worker_id);
@@ -2426,7 +2563,7 @@ class UpdateDensePrefixAndCompactionTask: public WorkerTask {
 
     // Once a thread has drained it's stack, it should try to steal regions from
     // other threads.
-    compaction_with_stealing_work(&_terminator, worker_id);
+    compaction_with_stealing_work(&_terminator, worker_id, _regions_by_node);
 
     // At this point all regions have been compacted, so it's now safe
     // to update the deferred objects that cross region boundaries.
@@ -2450,13 +2587,18 @@ void PSParallelCompact::compact() {
   // max push count is thus: last_space_id * (active_gc_threads * PAR_OLD_DENSE_PREFIX_OVER_PARTITIONING + 1)
   TaskQueue task_queue(last_space_id * (active_gc_threads * PAR_OLD_DENSE_PREFIX_OVER_PARTITIONING + 1));
   initialize_shadow_regions(active_gc_threads);
-  prepare_region_draining_tasks(active_gc_threads);
+  FillableRegionsByNode* regions_by_node = nullptr;
+  if (FillableRegionsByNode::should_use()) {
+    regions_by_node = new FillableRegionsByNode();
+  }
+
+  prepare_region_draining_tasks(active_gc_threads, regions_by_node);
   enqueue_dense_prefix_tasks(task_queue, active_gc_threads);
 
   {
     GCTraceTime(Trace, gc, phases) tm("Par Compact", &_gc_timer);
 
-    UpdateDensePrefixAndCompactionTask task(task_queue, active_gc_threads);
+    UpdateDensePrefixAndCompactionTask task(task_queue, active_gc_threads, regions_by_node);
     ParallelScavengeHeap::heap()->workers().run_task(&task);
 
 #ifdef  ASSERT
@@ -2467,6 +2609,8 @@ void PSParallelCompact::compact() {
 #endif
   }
 
+  delete regions_by_node;
+
   DEBUG_ONLY(write_block_fill_histogram());
 }
 
@@ -41,6 +41,7 @@ class PSAdaptiveSizePolicy;
 class PSYoungGen;
 class PSOldGen;
 class ParCompactionManager;
+class FillableRegionsByNode;
 class PSParallelCompact;
 class MoveAndUpdateClosure;
 class RefProcTaskExecutor;
@@ -1124,7 +1125,10 @@ class PSParallelCompact : AllStatic {
   static void compact();
 
   // Add available regions to the stack and draining tasks to the task queue.
-  static void prepare_region_draining_tasks(uint parallel_gc_threads);
+  // If regions_by_node is given, the available regions are grouped by NUMA
+  // node there instead of being distributed to the thread stacks.
+  static void prepare_region_draining_tasks(uint parallel_gc_threads,
+                                            FillableRegionsByNode* regions_by_node);
 
   // Add dense prefix update tasks to the task queue.
   static void enqueue_dense_prefix_tasks(TaskQueue& task_queue,
@@ -136,16 +136,18 @@ bool PSPromotionManager::post_scavenge(YoungGCTracer& gc_tracer) {
 void
 PSPromotionManager::print_local_stats(outputStream* const out, uint i) const {
   #define FMT " " SIZE_FORMAT_W(10)
-  out->print_cr("%3u" FMT FMT FMT FMT,
+  out->print_cr("%3u" FMT FMT FMT FMT " %10u" FMT,
                 i, _array_chunk_pushes, _array_chunk_steals,
-                _arrays_chunked, _array_chunks_processed);
+                _arrays_chunked, _array_chunks_processed,
+                _promotion_failed_info.failed_count(),
+                _promotion_failed_info.total_size());
   #undef FMT
 }
 
 static const char* const pm_stats_hdr[] = {
-  "    ----partial array----     arrays      array",
-  "thr       push      steal    chunked     chunks",
-  "--- ---------- ---------- ---------- ----------"
+  "    ----partial array----     arrays      array --promotion failed--",
+  "thr       push      steal    chunked     chunks      count      words",
+  "--- ---------- ---------- ---------- ---------- ---------- ----------"
 };
 
 void PSPromotionManager::print_taskqueue_stats() {
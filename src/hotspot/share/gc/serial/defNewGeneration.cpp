@@ -781,14 +781,17 @@ void DefNewGeneration::collect(bool   full,
 
     heap->young_process_roots(&root_cl,
                               &old_gen_cl,
-                              &cld_scan_closure);
+                              &cld_scan_closure,
+                              _gc_timer);
   }
 
-  // "evacuate followers".
-  evacuate_followers.do_void();
+  {
+    GCTraceTime(Debug, gc, phases) tm("Evacuate Followers", _gc_timer);
+    evacuate_followers.do_void();
+  }
 
   {
-    // Reference processing
+    GCTraceTime(Debug, gc, phases) tm("Reference Processing", _gc_timer);
     KeepAliveClosure keep_alive(this);
     ReferenceProcessor* rp = ref_processor();
     ReferenceProcessorPhaseTimes pt(_gc_timer, rp->max_num_queues());
@@ -801,6 +804,7 @@ void DefNewGeneration::collect(bool   full,
   assert(heap->no_allocs_since_save_marks(), "save marks have not been newly set.");
 
   {
+    GCTraceTime(Debug, gc, phases) tm("Weak Processing", _gc_timer);
     AdjustWeakRootClosure cl{this};
     WeakProcessor::weak_oops_do(&is_alive, &cl);
   }
@@ -27,6 +27,8 @@
 #include "gc/serial/serialHeap.hpp"
 #include "gc/serial/tenuredGeneration.inline.hpp"
 #include "gc/shared/gcLocker.inline.hpp"
+#include "gc/shared/gcTimer.hpp"
+#include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/genMemoryPools.hpp"
 #include "gc/shared/strongRootsScope.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
@@ -94,13 +96,20 @@ GrowableArray<MemoryPool*> SerialHeap::memory_pools() {
 
 void SerialHeap::young_process_roots(OopClosure* root_closure,
                                      OopIterateClosure* old_gen_closure,
-                                     CLDClosure* cld_closure) {
+                                     CLDClosure* cld_closure,
+                                     STWGCTimer* gc_timer) {
   MarkingCodeBlobClosure mark_code_closure(root_closure, CodeBlobToOopClosure::FixRelocations, false /* keepalive nmethods */);
 
-  process_roots(SO_ScavengeCodeCache, root_closure,
-                cld_closure, cld_closure, &mark_code_closure);
+  {
+    GCTraceTime(Debug, gc, phases) tm("Process Roots", gc_timer);
+    process_roots(SO_ScavengeCodeCache, root_closure,
+                  cld_closure, cld_closure, &mark_code_closure);
+  }
 
-  old_gen()->younger_refs_iterate(old_gen_closure);
+  {
+    GCTraceTime(Debug, gc, phases) tm("Scan Old-to-Young Cards", gc_timer);
+    old_gen()->younger_refs_iterate(old_gen_closure);
+  }
 }
 
 void SerialHeap::safepoint_synchronize_begin() {
@@ -33,6 +33,7 @@
 class GCMemoryManager;
 class MemoryPool;
 class OopIterateClosure;
+class STWGCTimer;
 class TenuredGeneration;
 
 // SerialHeap is the implementation of CollectedHeap for Serial GC.
@@ -99,7 +100,8 @@ class SerialHeap : public GenCollectedHeap {
 
   void young_process_roots(OopClosure* root_closure,
                            OopIterateClosure* old_gen_closure,
-                           CLDClosure* cld_closure);
+                           CLDClosure* cld_closure,
+                           STWGCTimer* gc_timer);
 
   void safepoint_synchronize_begin() override;
   void safepoint_synchronize_end() override;
@@ -59,6 +59,9 @@ CollectorCounters::CollectorCounters(const char* name, int ordinal) {
     _last_exit_time = PerfDataManager::create_variable(SUN_GC, cname,
                                                        PerfData::U_Ticks,
                                                        CHECK);
+
+    cname = PerfDataManager::counter_name(_name_space, "time");
+    _time_histogram = PerfDataManager::create_histogram(SUN_GC, cname, CHECK);
   }
 }
 
@@ -77,6 +80,8 @@ TraceCollectorStats::TraceCollectorStats(CollectorCounters* c) :
 
 TraceCollectorStats::~TraceCollectorStats() {
   if (UsePerfData) {
-    _c->last_exit_counter()->set_value(os::elapsed_counter());
+    jlong exit_time = os::elapsed_counter();
+    _c->last_exit_counter()->set_value(exit_time);
+    _c->time_histogram()->record(exit_time - _c->last_entry_counter()->get_value());
   }
 }
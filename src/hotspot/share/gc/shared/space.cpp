@@ -97,10 +97,16 @@ void DirtyCardToOopClosure::do_MemRegion(MemRegion mr) {
          "Not decreasing");
   NOT_PRODUCT(_last_bottom = mr.start());
 
-  bottom_obj = _sp->block_start(bottom);
-  top_obj    = _sp->block_start(last);
+  // Regions are visited in decreasing address order. If the block that
+  // contained the bottom of the previous region starts at or below the last
+  // word of this region, it also contains that word, and we can avoid walking
+  // the block offset table.
+  if (_last_bottom_obj != nullptr && _last_bottom_obj <= last) {
+    top_obj = _last_bottom_obj;
+  } else {
+    top_obj = _sp->block_start(last);
+  }
 
-  assert(bottom_obj <= bottom, "just checking");
   assert(top_obj    <= top,    "just checking");
 
   // Given what we think is the top of the memory region and
@@ -124,6 +130,12 @@ void DirtyCardToOopClosure::do_MemRegion(MemRegion mr) {
 
   // Walk the region if it is not empty; otherwise there is nothing to do.
   if (!extended_mr.is_empty()) {
+    // A block starting at or below bottom that contains last also contains
+    // bottom, so only look up the block start if that is not the case.
+    bottom_obj = (top_obj <= bottom) ? top_obj : _sp->block_start(bottom);
+    assert(bottom_obj <= bottom, "just checking");
+    _last_bottom_obj = bottom_obj;
+
     walk_mem_region(extended_mr, bottom_obj, top);
   }
 
@@ -138,6 +150,7 @@ void DirtyCardToOopClosure::walk_mem_region_with_cl(MemRegion mr,
   if (bottom < top) {
     HeapWord* next_obj = bottom + cast_to_oop(bottom)->size();
     while (next_obj < top) {
+      Prefetch::read(next_obj, PrefetchScanIntervalInBytes);
       /* Bottom lies entirely below top, so we can call the */
       /* non-memRegion version of oop_iterate below. */
       cast_to_oop(bottom)->oop_iterate(cl);
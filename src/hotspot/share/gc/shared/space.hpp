@@ -243,6 +243,9 @@ class DirtyCardToOopClosure: public MemRegionClosure {
                                 // lowest location already done (or,
                                 // alternatively, the lowest address that
                                 // shouldn't be done again.  null means infinity.)
+  HeapWord* _last_bottom_obj;   // The block start found for the bottom of
+                                // the previously walked region, which may
+                                // also cover the top of the next region.
   NOT_PRODUCT(HeapWord* _last_bottom;)
 
   // Get the actual top of the area on which the closure will
@@ -273,7 +276,7 @@ class DirtyCardToOopClosure: public MemRegionClosure {
                                OopIterateClosure* cl);
 public:
   DirtyCardToOopClosure(Space* sp, OopIterateClosure* cl) :
-    _cl(cl), _sp(sp), _min_done(nullptr) {
+    _cl(cl), _sp(sp), _min_done(nullptr), _last_bottom_obj(nullptr) {
     NOT_PRODUCT(_last_bottom = nullptr);
   }
 
@@ -61,6 +61,8 @@ class TaskQueueStats {
     steal_success,    // number of successful steals
     steal_max_contended_in_a_row, // maximum number of contended steals in a row
     steal_bias_drop,  // number of times the bias has been dropped
+    steal_node_local, // subset of successful steals from a queue on the same NUMA node
+    steal_node_remote,// subset of successful steals from a queue on another NUMA node
     overflow,         // number of overflow pushes
     overflow_max_len, // max length of overflow stack
     last_stat_id
@@ -82,6 +84,9 @@ class TaskQueueStats {
     }
   }
   inline void record_bias_drop() { ++_stats[steal_bias_drop]; }
+  inline void record_steal_node(bool same_node) {
+    ++_stats[same_node ? steal_node_local : steal_node_remote];
+  }
   inline void record_overflow(size_t new_length);
 
   TaskQueueStats & operator +=(const TaskQueueStats & addend);
@@ -480,11 +485,29 @@ class GenericTaskQueueSet: public TaskQueueSetSuperImpl<F> {
   uint _n;
   T** _queues;
 
+  // NUMA node index of the owner of each queue, used for node-aware stealing.
+  // nullptr if node-aware stealing is disabled.
+  uint* _node_index;
+
   // Attempts to steal an element from a foreign queue (!= queue_num), setting
   // the result in t. Validity of this value and the return value is the same
   // as for the last pop_global() operation.
   PopResult steal_best_of_2(uint queue_num, E& t);
 
+  // Node-aware variant of steal_best_of_2(). Samples two queues on the same
+  // node as queue_num and steals from the larger one. Only if both are empty,
+  // one attempt is made on a random queue that may be on any node, so that
+  // work still gets balanced across nodes.
+  PopResult steal_best_of_2_node_aware(uint queue_num, E& t);
+
+  // Returns a random queue id on the same node as queue_num that is neither
+  // queue_num nor exclude, or queue_num if there is no such queue.
+  uint random_queue_id_on_node(uint queue_num, uint exclude);
+
+  // Try to pop from queue k on behalf of queue_num, updating the steal bias
+  // and statistics.
+  PopResult try_steal_from(uint queue_num, uint k, E& t);
+
 public:
   GenericTaskQueueSet(uint n);
   ~GenericTaskQueueSet();
@@ -495,6 +518,15 @@ class GenericTaskQueueSet: public TaskQueueSetSuperImpl<F> {
 
   T* queue(uint n);
 
+  // Enable node-aware stealing. Queue owners are expected to keep their node
+  // index up to date using set_queue_node_index().
+  void enable_node_aware_stealing();
+  bool is_node_aware() const { return _node_index != nullptr; }
+
+  // Record that the owner of queue i currently executes on the given node.
+  void set_queue_node_index(uint i, uint node_index);
+  uint queue_node_index(uint i) const;
+
   // Try to steal a task from some other queue than queue_num. It may perform several attempts at doing so.
   // Returns if stealing succeeds, and sets "t" to the stolen task.
   bool steal(uint queue_num, E& t);
@@ -530,6 +562,20 @@ GenericTaskQueueSet<T, F>::queue(uint i) {
   return _queues[i];
 }
 
+template<class T, MEMFLAGS F> void
+GenericTaskQueueSet<T, F>::set_queue_node_index(uint i, uint node_index) {
+  assert(is_node_aware(), "must be");
+  assert(i < _n, "index out of range.");
+  _node_index[i] = node_index;
+}
+
+template<class T, MEMFLAGS F> uint
+GenericTaskQueueSet<T, F>::queue_node_index(uint i) const {
+  assert(is_node_aware(), "must be");
+  assert(i < _n, "index out of range.");
+  return _node_index[i];
+}
+
 #ifdef ASSERT
 template<class T, MEMFLAGS F>
 void GenericTaskQueueSet<T, F>::assert_empty() const {
@@ -39,7 +39,7 @@
 #include "utilities/stack.inline.hpp"
 
 template <class T, MEMFLAGS F>
-inline GenericTaskQueueSet<T, F>::GenericTaskQueueSet(uint n) : _n(n) {
+inline GenericTaskQueueSet<T, F>::GenericTaskQueueSet(uint n) : _n(n), _node_index(nullptr) {
   typedef T* GenericTaskQueuePtr;
   _queues = NEW_C_HEAP_ARRAY(GenericTaskQueuePtr, n, F);
   for (uint i = 0; i < n; i++) {
@@ -50,6 +50,16 @@ inline GenericTaskQueueSet<T, F>::GenericTaskQueueSet(uint n) : _n(n) {
 template <class T, MEMFLAGS F>
 inline GenericTaskQueueSet<T, F>::~GenericTaskQueueSet() {
   FREE_C_HEAP_ARRAY(T*, _queues);
+  FREE_C_HEAP_ARRAY(uint, _node_index);
+}
+
+template <class T, MEMFLAGS F>
+inline void GenericTaskQueueSet<T, F>::enable_node_aware_stealing() {
+  assert(!is_node_aware(), "already enabled");
+  _node_index = NEW_C_HEAP_ARRAY(uint, _n, F);
+  for (uint i = 0; i < _n; i++) {
+    _node_index[i] = 0;
+  }
 }
 
 #if TASKQUEUE_STATS
@@ -73,6 +83,27 @@ void GenericTaskQueueSet<T, F>::print_taskqueue_stats(outputStream* const st, co
   st->print_raw("tot "); totals.print(st); st->cr();
 
   DEBUG_ONLY(totals.verify());
+
+  if (is_node_aware()) {
+    // Per-node totals, attributed to the node the queue owner last ran on.
+    uint max_node = 0;
+    for (uint i = 0; i < n; ++i) {
+      max_node = MAX2(max_node, _node_index[i]);
+    }
+    for (uint node = 0; node <= max_node; ++node) {
+      TaskQueueStats node_totals;
+      bool found = false;
+      for (uint i = 0; i < n; ++i) {
+        if (_node_index[i] == node) {
+          node_totals += queue(i)->stats;
+          found = true;
+        }
+      }
+      if (found) {
+        st->print("n%-2u ", node); node_totals.print(st); st->cr();
+      }
+    }
+  }
 }
 
 template<class T, MEMFLAGS F>
@@ -316,6 +347,73 @@ int GenericTaskQueue<E, F, N>::next_random_queue_id() {
   return randomParkAndMiller(&_seed);
 }
 
+template<class T, MEMFLAGS F>
+uint GenericTaskQueueSet<T, F>::random_queue_id_on_node(uint queue_num, uint exclude) {
+  const uint node = _node_index[queue_num];
+  const uint start = queue(queue_num)->next_random_queue_id() % _n;
+  for (uint i = 0; i < _n; i++) {
+    uint k = (start + i) % _n;
+    if (k != queue_num && k != exclude && _node_index[k] == node) {
+      return k;
+    }
+  }
+  return queue_num;
+}
+
+template<class T, MEMFLAGS F>
+typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::try_steal_from(uint queue_num, uint k, E& t) {
+  T* const local_queue = queue(queue_num);
+  PopResult suc = queue(k)->pop_global(t);
+  TASKQUEUE_STATS_ONLY(local_queue->record_steal_attempt(suc);)
+  if (suc == PopResult::Success) {
+    TASKQUEUE_STATS_ONLY(local_queue->stats.record_steal_node(_node_index[k] == _node_index[queue_num]);)
+    local_queue->set_last_stolen_queue_id(k);
+  } else {
+    local_queue->invalidate_last_stolen_queue_id();
+  }
+  return suc;
+}
+
+template<class T, MEMFLAGS F>
+typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_best_of_2_node_aware(uint queue_num, E& t) {
+  T* const local_queue = queue(queue_num);
+  const uint node = _node_index[queue_num];
+
+  uint k1 = queue_num;
+  if (local_queue->is_last_stolen_queue_id_valid() &&
+      _node_index[local_queue->last_stolen_queue_id()] == node) {
+    k1 = local_queue->last_stolen_queue_id();
+    assert(k1 != queue_num, "Should not be the same");
+  } else {
+    k1 = random_queue_id_on_node(queue_num, queue_num);
+  }
+
+  if (k1 != queue_num) {
+    uint k2 = random_queue_id_on_node(queue_num, k1);
+    // Sample both and try the larger.
+    uint sz1 = queue(k1)->size();
+    uint sz2 = (k2 != queue_num) ? queue(k2)->size() : 0;
+
+    if (sz2 > sz1) {
+      return try_steal_from(queue_num, k2, t);
+    } else if (sz1 > 0) {
+      return try_steal_from(queue_num, k1, t);
+    }
+  }
+
+  // No work found on this node; allow a single cross-node attempt.
+  uint k = queue_num;
+  while (k == queue_num) {
+    k = local_queue->next_random_queue_id() % _n;
+  }
+  if (queue(k)->size() > 0) {
+    return try_steal_from(queue_num, k, t);
+  }
+  TASKQUEUE_STATS_ONLY(local_queue->record_steal_attempt(PopResult::Empty);)
+  local_queue->invalidate_last_stolen_queue_id();
+  return PopResult::Empty;
+}
+
 template<class T, MEMFLAGS F>
 typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
   T* const local_queue = queue(queue_num);
@@ -378,7 +476,8 @@ bool GenericTaskQueueSet<T, F>::steal(uint queue_num, E& t) {
 
   TASKQUEUE_STATS_ONLY(uint contended_in_a_row = 0;)
   for (uint i = 0; i < num_retries; i++) {
-    PopResult sr = steal_best_of_2(queue_num, t);
+    PopResult sr = (is_node_aware() && _n > 2) ? steal_best_of_2_node_aware(queue_num, t)
+                                               : steal_best_of_2(queue_num, t);
     if (sr == PopResult::Success) {
       return true;
     } else if (sr == PopResult::Contended) {
@@ -186,6 +186,18 @@ void ThreadLocalAllocBuffer::fill(HeapWord* start,
   _number_of_refills++;
   _allocated_size += new_size;
   print_stats("fill");
+
+  if (ResizeTLAB && ResizeTLABOnRefill && (_number_of_refills % _target_refills) == 0) {
+    // The thread allocates faster than resize() predicted from the previous
+    // GC interval. Grow the following TLABs now; resize() recomputes the size
+    // at the next GC, which also shrinks TLABs of threads that went idle.
+    size_t new_desired_size = align_object_size(MIN2(desired_size() * 2, max_size()));
+    log_trace(gc, tlab)("TLAB boost: thread: " PTR_FORMAT " [id: %2d] refills %u desired_size: "
+                        SIZE_FORMAT " -> " SIZE_FORMAT,
+                        p2i(thread()), thread()->osthread()->thread_id(),
+                        _number_of_refills, desired_size(), new_desired_size);
+    set_desired_size(new_desired_size);
+  }
   assert(top <= start + new_size - alignment_reserve(), "size too small");
 
   initialize(start, top, start + new_size - alignment_reserve());
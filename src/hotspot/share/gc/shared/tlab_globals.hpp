@@ -43,6 +43,11 @@
   product(bool, ResizeTLAB, true,                                           \
           "Dynamically resize TLAB size for threads")                       \
                                                                             \
+  product(bool, ResizeTLABOnRefill, false, EXPERIMENTAL,                    \
+          "Grow the TLAB of a thread that has used up its expected number " \
+          "of refills before the next GC, instead of waiting for the "      \
+          "resize at GC")                                                   \
+                                                                            \
   product(bool, ZeroTLAB, false,                                            \
           "Zero out the newly created TLAB")                                \
                                                                             \
@@ -26,17 +26,20 @@
 #include "gc/shared/tlab_globals.hpp"
 #include "gc/shenandoah/shenandoahFreeSet.hpp"
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
+#include "gc/shenandoah/shenandoahHeapRegion.inline.hpp"
 #include "gc/shenandoah/shenandoahHeapRegionSet.hpp"
 #include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/orderAccess.hpp"
 
 ShenandoahFreeSet::ShenandoahFreeSet(ShenandoahHeap* heap, size_t max_regions) :
   _heap(heap),
   _mutator_free_bitmap(max_regions, mtGC),
   _collector_free_bitmap(max_regions, mtGC),
-  _max(max_regions)
+  _max(max_regions),
+  _mutator_alloc_region(nullptr)
 {
   clear_internal();
 }
@@ -78,11 +81,25 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
     case ShenandoahAllocRequest::_alloc_tlab:
     case ShenandoahAllocRequest::_alloc_shared: {
 
+      // Another thread might have installed a new lock-free allocation region
+      // while we were waiting for the lock
+      if (ShenandoahLockFreeMutatorAlloc) {
+        HeapWord* result = allocate_lock_free(req);
+        if (result != nullptr) {
+          return result;
+        }
+      }
+
       // Try to allocate in the mutator view
       for (size_t idx = _mutator_leftmost; idx <= _mutator_rightmost; idx++) {
         if (is_mutator_free(idx)) {
-          HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
+          ShenandoahHeapRegion* r = _heap->get_region(idx);
+          HeapWord* result = try_allocate_in(r, req, in_new_region);
           if (result != nullptr) {
+            if (ShenandoahLockFreeMutatorAlloc && is_mutator_free(idx)) {
+              // Region was not retired, let subsequent allocations go there without the lock
+              set_mutator_alloc_region(r);
+            }
             return result;
           }
         }
@@ -386,6 +403,69 @@ void ShenandoahFreeSet::flip_to_gc(ShenandoahHeapRegion* r) {
   assert_bounds();
 }
 
+void ShenandoahFreeSet::set_mutator_alloc_region(ShenandoahHeapRegion* r) {
+  shenandoah_assert_heaplocked();
+  assert(r->is_regular() || r->is_pinned(), "Only regular regions can be allocated lock-free: " SIZE_FORMAT, r->index());
+
+  retire_mutator_alloc_region();
+
+  size_t idx = r->index();
+  assert(_mutator_free_bitmap.at(idx), "Should be in mutator view");
+
+  // Lock-free allocations do not update the free set accounting, so the
+  // whole remaining space is considered used from now on.
+  increase_used(r->free());
+  _mutator_free_bitmap.clear_bit(idx);
+  if (touches_bounds(idx)) {
+    adjust_bounds();
+  }
+  assert_bounds();
+
+  Atomic::release_store(&_mutator_alloc_region, r);
+}
+
+void ShenandoahFreeSet::retire_mutator_alloc_region() {
+  shenandoah_assert_heaplocked();
+
+  ShenandoahHeapRegion* r = _mutator_alloc_region;
+  if (r == nullptr) {
+    return;
+  }
+  Atomic::store(&_mutator_alloc_region, (ShenandoahHeapRegion*)nullptr);
+
+  // Threads that have already loaded the region can still allocate from it,
+  // so close it first: only what is left after that is reported as waste.
+  // The remainder is filled to keep the region parsable above TAMS.
+  HeapWord* waste_start = r->close_atomic();
+  size_t waste = pointer_delta(r->end(), waste_start);
+  if (waste >= CollectedHeap::min_fill_size()) {
+    CollectedHeap::fill_with_object(waste_start, waste);
+    _heap->notify_mutator_alloc_words(waste, true);
+  }
+}
+
+HeapWord* ShenandoahFreeSet::allocate_lock_free(ShenandoahAllocRequest& req) {
+  assert(req.is_mutator_alloc(), "Only mutator allocations are lock-free");
+  assert(req.size() <= ShenandoahHeapRegion::humongous_threshold_words(), "Humongous allocations take the lock");
+
+  ShenandoahHeapRegion* r = Atomic::load_acquire(&_mutator_alloc_region);
+  if (r == nullptr) {
+    return nullptr;
+  }
+
+  size_t min_size = req.size();
+  if (ShenandoahElasticTLAB && req.is_lab_alloc()) {
+    min_size = req.min_size();
+  }
+
+  size_t actual_size = 0;
+  HeapWord* result = r->allocate_atomic(req.size(), min_size, req.type(), actual_size);
+  if (result != nullptr) {
+    req.set_actual_size(actual_size);
+  }
+  return result;
+}
+
 void ShenandoahFreeSet::clear() {
   shenandoah_assert_heaplocked();
   clear_internal();
@@ -400,6 +480,8 @@ void ShenandoahFreeSet::clear_internal() {
   _collector_rightmost = 0;
   _capacity = 0;
   _used = 0;
+  // Mutator allocation region goes back to the mutator view on rebuild.
+  Atomic::store(&_mutator_alloc_region, (ShenandoahHeapRegion*)nullptr);
 }
 
 void ShenandoahFreeSet::rebuild() {
@@ -562,6 +644,11 @@ HeapWord* ShenandoahFreeSet::allocate(ShenandoahAllocRequest& req, bool& in_new_
 size_t ShenandoahFreeSet::unsafe_peek_free() const {
   // Deliberately not locked, this method is unsafe when free set is modified.
 
+  ShenandoahHeapRegion* alloc_region = Atomic::load_acquire(&_mutator_alloc_region);
+  if (alloc_region != nullptr && alloc_region->free() >= MinTLABSize) {
+    return alloc_region->free();
+  }
+
   for (size_t index = _mutator_leftmost; index <= _mutator_rightmost; index++) {
     if (index < _max && is_mutator_free(index)) {
       ShenandoahHeapRegion* r = _heap->get_region(index);
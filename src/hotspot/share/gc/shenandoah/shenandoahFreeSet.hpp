@@ -43,6 +43,12 @@ class ShenandoahFreeSet : public CHeapObj<mtGC> {
   size_t _capacity;
   size_t _used;
 
+  // Region that mutators bump-allocate in without taking the heap lock. It is
+  // removed from the mutator view when published, and its remaining free space
+  // is accounted as used up front. Only changed under the heap lock, and
+  // reset when the free set is rebuilt at a safepoint.
+  ShenandoahHeapRegion* volatile _mutator_alloc_region;
+
   void assert_bounds() const NOT_DEBUG_RETURN;
 
   bool is_mutator_free(size_t idx) const;
@@ -54,6 +60,9 @@ class ShenandoahFreeSet : public CHeapObj<mtGC> {
 
   void flip_to_gc(ShenandoahHeapRegion* r);
 
+  void set_mutator_alloc_region(ShenandoahHeapRegion* r);
+  void retire_mutator_alloc_region();
+
   void recompute_bounds();
   void adjust_bounds();
   bool touches_bounds(size_t num) const;
@@ -88,6 +97,10 @@ class ShenandoahFreeSet : public CHeapObj<mtGC> {
   }
 
   HeapWord* allocate(ShenandoahAllocRequest& req, bool& in_new_region);
+
+  // Try to satisfy a mutator TLAB or shared allocation from the current
+  // mutator allocation region without taking the heap lock.
+  HeapWord* allocate_lock_free(ShenandoahAllocRequest& req);
   size_t unsafe_peek_free() const;
 
   double internal_fragmentation();
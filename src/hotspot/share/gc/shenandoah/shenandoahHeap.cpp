@@ -870,7 +870,12 @@ HeapWord* ShenandoahHeap::allocate_memory(ShenandoahAllocRequest& req) {
     }
 
     if (!ShenandoahAllocFailureALot || !should_inject_alloc_failure()) {
-      result = allocate_memory_under_lock(req, in_new_region);
+      if (ShenandoahLockFreeMutatorAlloc && req.size() <= ShenandoahHeapRegion::humongous_threshold_words()) {
+        result = _free_set->allocate_lock_free(req);
+      }
+      if (result == nullptr) {
+        result = allocate_memory_under_lock(req, in_new_region);
+      }
     }
 
     // Allocation failed, block until control thread reacted, then retry allocation.
@@ -337,6 +337,18 @@ class ShenandoahHeapRegion {
   // Allocation (return null if full)
   inline HeapWord* allocate(size_t word_size, ShenandoahAllocRequest::Type type);
 
+  // Lock-free allocation of at least min_word_size and at most word_size words
+  // (return null if full). Only valid for regular regions that the free set
+  // handed out for lock-free mutator allocation. The allocated size is
+  // returned in actual_word_size.
+  inline HeapWord* allocate_atomic(size_t word_size, size_t min_word_size,
+                                   ShenandoahAllocRequest::Type type, size_t& actual_word_size);
+
+  // Atomically move top to end, so that no lock-free allocation can succeed
+  // in this region any more. Returns the start of the space that was left,
+  // or top if less than a filler object was left.
+  inline HeapWord* close_atomic();
+
   inline void clear_live_data();
   void set_live_data(size_t s);
 
@@ -379,6 +391,7 @@ class ShenandoahHeapRegion {
   size_t free() const           { return byte_size(top(),    end()); }
 
   inline void adjust_alloc_metadata(ShenandoahAllocRequest::Type type, size_t);
+  inline void adjust_alloc_metadata_atomic(ShenandoahAllocRequest::Type type, size_t);
   void reset_alloc_metadata();
   size_t get_shared_allocs() const;
   size_t get_tlab_allocs() const;
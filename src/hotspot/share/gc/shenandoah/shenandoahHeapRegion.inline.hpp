@@ -52,6 +52,46 @@ HeapWord* ShenandoahHeapRegion::allocate(size_t size, ShenandoahAllocRequest::Ty
   }
 }
 
+HeapWord* ShenandoahHeapRegion::allocate_atomic(size_t size, size_t min_size,
+                                                ShenandoahAllocRequest::Type type, size_t& actual_size) {
+  assert(is_object_aligned(size), "alloc size breaks alignment: " SIZE_FORMAT, size);
+  assert(min_size <= size, "min size is sane: " SIZE_FORMAT " <= " SIZE_FORMAT, min_size, size);
+
+  HeapWord* obj = Atomic::load(&_top);
+  while (true) {
+    size_t free = align_down(pointer_delta(end(), obj), MinObjAlignment);
+    if (free < min_size) {
+      return nullptr;
+    }
+    size_t alloc_size = MIN2(size, free);
+    HeapWord* new_top = obj + alloc_size;
+    HeapWord* witness = Atomic::cmpxchg(&_top, obj, new_top);
+    if (witness == obj) {
+      adjust_alloc_metadata_atomic(type, alloc_size);
+      actual_size = alloc_size;
+
+      assert(is_object_aligned(new_top), "new top breaks alignment: " PTR_FORMAT, p2i(new_top));
+      assert(is_object_aligned(obj),     "obj is not aligned: "       PTR_FORMAT, p2i(obj));
+
+      return obj;
+    }
+    obj = witness;
+  }
+}
+
+HeapWord* ShenandoahHeapRegion::close_atomic() {
+  HeapWord* obj = Atomic::load(&_top);
+  while (pointer_delta(end(), obj) >= CollectedHeap::min_fill_size()) {
+    HeapWord* witness = Atomic::cmpxchg(&_top, obj, end());
+    if (witness == obj) {
+      break;
+    }
+    obj = witness;
+  }
+  // Anything smaller than a filler is too small for any allocation as well.
+  return obj;
+}
+
 inline void ShenandoahHeapRegion::adjust_alloc_metadata(ShenandoahAllocRequest::Type type, size_t size) {
   switch (type) {
     case ShenandoahAllocRequest::_alloc_shared:
@@ -69,6 +109,19 @@ inline void ShenandoahHeapRegion::adjust_alloc_metadata(ShenandoahAllocRequest::
   }
 }
 
+inline void ShenandoahHeapRegion::adjust_alloc_metadata_atomic(ShenandoahAllocRequest::Type type, size_t size) {
+  switch (type) {
+    case ShenandoahAllocRequest::_alloc_shared:
+      // Counted implicitly by tlab/gclab allocs
+      break;
+    case ShenandoahAllocRequest::_alloc_tlab:
+      Atomic::add(&_tlab_allocs, size, memory_order_relaxed);
+      break;
+    default:
+      ShouldNotReachHere();
+  }
+}
+
 inline void ShenandoahHeapRegion::increase_live_data_alloc_words(size_t s) {
   internal_increase_live_data(s);
 }
@@ -223,6 +223,10 @@
   product(bool, ShenandoahElasticTLAB, true, DIAGNOSTIC,                    \
           "Use Elastic TLABs with Shenandoah")                              \
                                                                             \
+  product(bool, ShenandoahLockFreeMutatorAlloc, false, EXPERIMENTAL,       \
+          "Let mutators allocate TLABs and shared objects in the current "  \
+          "allocation region without taking the heap lock")                 \
+                                                                            \
   product(uintx, ShenandoahEvacReserve, 5, EXPERIMENTAL,                    \
           "How much of heap to reserve for evacuations. Larger values make "\
           "GC evacuate more live objects on every cycle, while leaving "    \
@@ -185,9 +185,44 @@ static double fragmentation_limit(ZGenerationId generation) {
   }
 }
 
+double ZGeneration::adaptive_fragmentation_limit(double limit) const {
+  const double relocation_rate = _stat_relocation.relocation_rate();
+  const double alloc_rate = ZStatMutatorAllocRate::stats()._avg;
+  const size_t soft_max_capacity = ZHeap::heap()->soft_max_capacity();
+  const size_t used = MIN2(ZHeap::heap()->used(), soft_max_capacity);
+  if (relocation_rate == 0.0 || soft_max_capacity == 0) {
+    // No relocation history yet
+    return limit;
+  }
+
+  // When the mutators allocate at a rate close to what the GC workers
+  // relocate, the workers compete with the mutators for CPU. Raise the limit,
+  // so that only the pages that free the most memory per relocated byte are
+  // selected.
+  const double cpu_factor = 1.0 + MIN2(alloc_rate / relocation_rate, 1.0);
+
+  // When free memory gets tight, lower the limit to relocate more pages and
+  // compact the heap more aggressively.
+  const double free_ratio = (double)(soft_max_capacity - used) / (double)soft_max_capacity;
+  const double memory_factor = clamp(free_ratio * 2.0, 0.25, 1.0);
+
+  const double adapted = clamp(limit * cpu_factor * memory_factor, limit * 0.25, MIN2(limit * 2.0, 100.0));
+
+  log_debug(gc, reloc)("Adaptive Fragmentation Limit: %.1f%% -> %.1f%% "
+                       "(Relocation Rate: %.1fMB/s, Allocation Rate: %.1fMB/s, Free: %.1f%%)",
+                       limit, adapted, relocation_rate / M, alloc_rate / M, free_ratio * 100.0);
+
+  return adapted;
+}
+
 void ZGeneration::select_relocation_set(ZGenerationId generation, bool promote_all) {
+  double limit = fragmentation_limit(generation);
+  if (ZAdaptiveFragmentationLimit) {
+    limit = adaptive_fragmentation_limit(limit);
+  }
+
   // Register relocatable pages with selector
-  ZRelocationSetSelector selector(fragmentation_limit(generation));
+  ZRelocationSetSelector selector(limit);
   {
     ZGenerationPagesIterator pt_iter(_page_table, _id, _page_allocator);
     for (ZPage* page; pt_iter.next(&page);) {
@@ -919,9 +954,11 @@ void ZGenerationYoung::relocate_start() {
 
 void ZGenerationYoung::relocate() {
   // Relocate relocation set
+  const Ticks start = Ticks::now();
   _relocate.relocate(&_relocation_set);
 
   // Update statistics
+  stat_relocation()->at_relocate_duration(Ticks::now() - start);
   stat_heap()->at_relocate_end(_page_allocator->stats(this), should_record_stats());
 }
 
@@ -1377,9 +1414,11 @@ void ZGenerationOld::relocate_start() {
 
 void ZGenerationOld::relocate() {
   // Relocate relocation set
+  const Ticks start = Ticks::now();
   _relocate.relocate(&_relocation_set);
 
   // Update statistics
+  stat_relocation()->at_relocate_duration(Ticks::now() - start);
   stat_heap()->at_relocate_end(_page_allocator->stats(this), should_record_stats());
 }
 
@@ -91,6 +91,7 @@ class ZGeneration {
 
   void mark_free();
 
+  double adaptive_fragmentation_limit(double limit) const;
   void select_relocation_set(ZGenerationId generation, bool promote_all);
   void reset_relocation_set();
 
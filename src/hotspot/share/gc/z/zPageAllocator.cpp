@@ -31,6 +31,7 @@
 #include "gc/z/zGenerationId.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zLock.inline.hpp"
+#include "gc/z/zNUMA.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAge.hpp"
 #include "gc/z/zPageAllocator.inline.hpp"
@@ -473,8 +474,14 @@ bool ZPageAllocator::alloc_page_common_inner(ZPageType type, size_t size, ZList<
     return false;
   }
 
-  // Try allocate from the page cache
-  ZPage* const page = _cache.alloc_page(type, size);
+  // Try allocate from the page cache. With NUMA, pages cached on remote
+  // nodes are only used when the capacity can not be increased to satisfy
+  // the allocation, since newly committed memory will be touched, and
+  // therefore placed, by the allocating thread.
+  const bool allow_remote = !ZNUMA::is_enabled() ||
+                            !ZPageCacheNUMALocalFirst ||
+                            _current_max_capacity - _capacity < size;
+  ZPage* const page = _cache.alloc_page(type, size, allow_remote);
   if (page != nullptr) {
     // Success
     pages->insert_last(page);
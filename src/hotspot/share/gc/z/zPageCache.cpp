@@ -24,7 +24,7 @@
 #include "precompiled.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zList.inline.hpp"
-#include "gc/z/zNUMA.hpp"
+#include "gc/z/zNUMA.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageCache.hpp"
 #include "gc/z/zStat.hpp"
@@ -37,6 +37,8 @@ static const ZStatCounter ZCounterPageCacheHitL1("Memory", "Page Cache Hit L1",
 static const ZStatCounter ZCounterPageCacheHitL2("Memory", "Page Cache Hit L2", ZStatUnitOpsPerSecond);
 static const ZStatCounter ZCounterPageCacheHitL3("Memory", "Page Cache Hit L3", ZStatUnitOpsPerSecond);
 static const ZStatCounter ZCounterPageCacheMiss("Memory", "Page Cache Miss", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterPageCacheHitNUMALocal("Memory", "Page Cache Hit NUMA Local", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterPageCacheHitNUMARemote("Memory", "Page Cache Hit NUMA Remote", ZStatUnitOpsPerSecond);
 
 class ZPageCacheFlushClosure : public StackObj {
   friend class ZPageCache;
@@ -60,17 +62,21 @@ ZPageCache::ZPageCache()
     _large(),
     _last_commit(0) {}
 
-ZPage* ZPageCache::alloc_small_page() {
+ZPage* ZPageCache::alloc_numa_page(ZPerNUMA<ZList<ZPage> >* lists, bool allow_remote) {
   const uint32_t numa_id = ZNUMA::id();
   const uint32_t numa_count = ZNUMA::count();
 
   // Try NUMA local page cache
-  ZPage* const l1_page = _small.get(numa_id).remove_first();
+  ZPage* const l1_page = lists->get(numa_id).remove_first();
   if (l1_page != nullptr) {
     ZStatInc(ZCounterPageCacheHitL1);
     return l1_page;
   }
 
+  if (!allow_remote) {
+    return nullptr;
+  }
+
   // Try NUMA remote page cache(s)
   uint32_t remote_numa_id = numa_id + 1;
   const uint32_t remote_numa_count = numa_count - 1;
@@ -79,7 +85,7 @@ ZPage* ZPageCache::alloc_small_page() {
       remote_numa_id = 0;
     }
 
-    ZPage* const l2_page = _small.get(remote_numa_id).remove_first();
+    ZPage* const l2_page = lists->get(remote_numa_id).remove_first();
     if (l2_page != nullptr) {
       ZStatInc(ZCounterPageCacheHitL2);
       return l2_page;
@@ -91,14 +97,12 @@ ZPage* ZPageCache::alloc_small_page() {
   return nullptr;
 }
 
-ZPage* ZPageCache::alloc_medium_page() {
-  ZPage* const page = _medium.remove_first();
-  if (page != nullptr) {
-    ZStatInc(ZCounterPageCacheHitL1);
-    return page;
-  }
+ZPage* ZPageCache::alloc_small_page(bool allow_remote) {
+  return alloc_numa_page(&_small, allow_remote);
+}
 
-  return nullptr;
+ZPage* ZPageCache::alloc_medium_page(bool allow_remote) {
+  return alloc_numa_page(&_medium, allow_remote);
 }
 
 ZPage* ZPageCache::alloc_large_page(size_t size) {
@@ -116,9 +120,19 @@ ZPage* ZPageCache::alloc_large_page(size_t size) {
   return nullptr;
 }
 
-ZPage* ZPageCache::alloc_oversized_medium_page(size_t size) {
+ZPage* ZPageCache::alloc_oversized_medium_page(size_t size, bool allow_remote) {
   if (size <= ZPageSizeMedium) {
-    return _medium.remove_first();
+    const uint32_t numa_id = ZNUMA::id();
+    const uint32_t numa_count = ZNUMA::count();
+    const uint32_t numa_tries = allow_remote ? numa_count : 1;
+
+    // Start with the NUMA local page cache
+    for (uint32_t i = 0; i < numa_tries; i++) {
+      ZPage* const page = _medium.get((numa_id + i) % numa_count).remove_first();
+      if (page != nullptr) {
+        return page;
+      }
+    }
   }
 
   return nullptr;
@@ -138,10 +152,10 @@ ZPage* ZPageCache::alloc_oversized_large_page(size_t size) {
   return nullptr;
 }
 
-ZPage* ZPageCache::alloc_oversized_page(size_t size) {
+ZPage* ZPageCache::alloc_oversized_page(size_t size, bool allow_remote) {
   ZPage* page = alloc_oversized_large_page(size);
   if (page == nullptr) {
-    page = alloc_oversized_medium_page(size);
+    page = alloc_oversized_medium_page(size, allow_remote);
   }
 
   if (page != nullptr) {
@@ -151,21 +165,21 @@ ZPage* ZPageCache::alloc_oversized_page(size_t size) {
   return page;
 }
 
-ZPage* ZPageCache::alloc_page(ZPageType type, size_t size) {
+ZPage* ZPageCache::alloc_page(ZPageType type, size_t size, bool allow_remote) {
   ZPage* page;
 
   // Try allocate exact page
   if (type == ZPageType::small) {
-    page = alloc_small_page();
+    page = alloc_small_page(allow_remote);
   } else if (type == ZPageType::medium) {
-    page = alloc_medium_page();
+    page = alloc_medium_page(allow_remote);
   } else {
     page = alloc_large_page(size);
   }
 
   if (page == nullptr) {
     // Try allocate potentially oversized page
-    ZPage* const oversized = alloc_oversized_page(size);
+    ZPage* const oversized = alloc_oversized_page(size, allow_remote);
     if (oversized != nullptr) {
       if (size < oversized->size()) {
         // Split oversized page
@@ -182,6 +196,12 @@ ZPage* ZPageCache::alloc_page(ZPageType type, size_t size) {
 
   if (page == nullptr) {
     ZStatInc(ZCounterPageCacheMiss);
+  } else if (ZNUMA::is_enabled() && type != ZPageType::large) {
+    if (page->numa_id() == ZNUMA::id()) {
+      ZStatInc(ZCounterPageCacheHitNUMALocal);
+    } else {
+      ZStatInc(ZCounterPageCacheHitNUMARemote);
+    }
   }
 
   return page;
@@ -192,7 +212,7 @@ void ZPageCache::free_page(ZPage* page) {
   if (type == ZPageType::small) {
     _small.get(page->numa_id()).insert_first(page);
   } else if (type == ZPageType::medium) {
-    _medium.insert_first(page);
+    _medium.get(page->numa_id()).insert_first(page);
   } else {
     _large.insert_first(page);
   }
@@ -240,7 +260,7 @@ void ZPageCache::flush_per_numa_lists(ZPageCacheFlushClosure* cl, ZPerNUMA<ZList
 void ZPageCache::flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to) {
   // Prefer flushing large, then medium and last small pages
   flush_list(cl, &_large, to);
-  flush_list(cl, &_medium, to);
+  flush_per_numa_lists(cl, &_medium, to);
   flush_per_numa_lists(cl, &_small, to);
 
   if (cl->_flushed > cl->_requested) {
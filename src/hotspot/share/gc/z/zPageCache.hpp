@@ -34,17 +34,18 @@ class ZPageCacheFlushClosure;
 class ZPageCache {
 private:
   ZPerNUMA<ZList<ZPage> > _small;
-  ZList<ZPage>            _medium;
+  ZPerNUMA<ZList<ZPage> > _medium;
   ZList<ZPage>            _large;
   uint64_t                _last_commit;
 
-  ZPage* alloc_small_page();
-  ZPage* alloc_medium_page();
+  ZPage* alloc_numa_page(ZPerNUMA<ZList<ZPage> >* lists, bool allow_remote);
+  ZPage* alloc_small_page(bool allow_remote);
+  ZPage* alloc_medium_page(bool allow_remote);
   ZPage* alloc_large_page(size_t size);
 
-  ZPage* alloc_oversized_medium_page(size_t size);
+  ZPage* alloc_oversized_medium_page(size_t size, bool allow_remote);
   ZPage* alloc_oversized_large_page(size_t size);
-  ZPage* alloc_oversized_page(size_t size);
+  ZPage* alloc_oversized_page(size_t size, bool allow_remote);
 
   bool flush_list_inner(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
   void flush_list(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
@@ -54,7 +55,9 @@ class ZPageCache {
 public:
   ZPageCache();
 
-  ZPage* alloc_page(ZPageType type, size_t size);
+  // Small and medium pages are cached per NUMA node. If allow_remote is false,
+  // only pages on the current thread's NUMA node are considered for those.
+  ZPage* alloc_page(ZPageType type, size_t size, bool allow_remote = true);
   void free_page(ZPage* page);
 
   void flush_for_allocation(size_t requested, ZList<ZPage>* to);
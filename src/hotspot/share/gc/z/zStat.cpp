@@ -1465,7 +1465,8 @@ ZStatRelocation::ZStatRelocation()
     _small_selected(),
     _small_in_place_count(),
     _medium_selected(),
-    _medium_in_place_count() {}
+    _medium_in_place_count(),
+    _relocation_rate() {}
 
 void ZStatRelocation::at_select_relocation_set(const ZRelocationSetSelectorStats& selector_stats) {
   _selector_stats = selector_stats;
@@ -1480,6 +1481,24 @@ void ZStatRelocation::at_relocate_end(size_t small_in_place_count, size_t medium
   _medium_in_place_count = medium_in_place_count;
 }
 
+void ZStatRelocation::at_relocate_duration(const Tickspan& duration) {
+  size_t relocated = 0;
+  for (uint i = 0; i <= ZPageAgeMax; ++i) {
+    const ZPageAge age = static_cast<ZPageAge>(i);
+    relocated += _selector_stats.small(age).relocate();
+    relocated += _selector_stats.medium(age).relocate();
+  }
+
+  const double seconds = duration.seconds();
+  if (relocated > 0 && seconds > 0.0) {
+    _relocation_rate.add(relocated / seconds);
+  }
+}
+
+double ZStatRelocation::relocation_rate() const {
+  return _relocation_rate.num() > 0 ? _relocation_rate.davg() : 0.0;
+}
+
 void ZStatRelocation::print_page_summary() {
   LogTarget(Info, gc, reloc) lt;
 
@@ -530,6 +530,7 @@ class ZStatRelocation {
   size_t                      _small_in_place_count;
   size_t                      _medium_selected;
   size_t                      _medium_in_place_count;
+  TruncatedSeq                _relocation_rate;
 
   void print(const char* name,
              ZStatRelocationSummary selector_group,
@@ -541,6 +542,11 @@ class ZStatRelocation {
   void at_select_relocation_set(const ZRelocationSetSelectorStats& selector_stats);
   void at_install_relocation_set(size_t forwarding_usage);
   void at_relocate_end(size_t small_in_place_count, size_t medium_in_place_count);
+  void at_relocate_duration(const Tickspan& duration);
+
+  // Average relocation throughput in bytes per second over recent cycles,
+  // or zero if not yet known.
+  double relocation_rate() const;
 
   void print_page_summary();
   void print_age_table();
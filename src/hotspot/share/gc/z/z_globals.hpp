@@ -47,6 +47,11 @@
   product(bool, ZCollectionIntervalOnly, false,                             \
           "Only use timers for GC heuristics")                              \
                                                                             \
+  product(bool, ZAdaptiveFragmentationLimit, false, EXPERIMENTAL,           \
+          "Adjust the fragmentation limit used for relocation set "         \
+          "selection based on the observed relocation throughput, the "     \
+          "mutator allocation rate and the amount of free memory")          \
+                                                                            \
   product(bool, ZBufferStoreBarriers, true, DIAGNOSTIC,                     \
           "Buffer store barriers")                                          \
                                                                             \
@@ -61,6 +66,11 @@
           "0: Claim tree "                                                  \
           "1: Simple Striped ")                                             \
                                                                             \
+  product(bool, ZPageCacheNUMALocalFirst, true, EXPERIMENTAL,               \
+          "Prefer committing new memory over reusing small and medium "     \
+          "pages cached on remote NUMA nodes, as long as the heap "         \
+          "capacity can be increased")                                      \
+                                                                            \
   product(bool, ZVerifyRemembered, trueInDebug, DIAGNOSTIC,                 \
           "Verify remembered sets")                                         \
                                                                             \
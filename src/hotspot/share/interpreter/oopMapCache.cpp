@@ -441,15 +441,20 @@ void InterpreterOopMap::resource_copy(OopMapCacheEntry* from) {
 inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int bci) const {
   // We use method->code_size() rather than method->identity_hash() below since
   // the mark may not be present if a pointer to the method is already reversed.
+  // The idnum separates methods of the holder with the same shape.
   return   ((unsigned int) bci)
          ^ ((unsigned int) method->max_locals()         << 2)
          ^ ((unsigned int) method->code_size()          << 4)
-         ^ ((unsigned int) method->size_of_parameters() << 6);
+         ^ ((unsigned int) method->size_of_parameters() << 6)
+         ^ ((unsigned int) method->method_idnum()       << 8);
 }
 
 OopMapCacheEntry* volatile OopMapCache::_old_entries = nullptr;
 
-OopMapCache::OopMapCache() {
+// The cache is per holder class, so a class with many methods gets more slots
+// instead of evicting its hot entries from a small fixed-size table.
+OopMapCache::OopMapCache(int nof_methods) :
+  _size(clamp(nof_methods * 2, (int)_min_size, (int)_max_size)) {
   _array  = NEW_C_HEAP_ARRAY(OopMapCacheEntry*, _size, mtClass);
   for(int i = 0; i < _size; i++) _array[i] = nullptr;
 }
@@ -153,10 +153,12 @@ class InterpreterOopMap: ResourceObj {
 class OopMapCache : public CHeapObj<mtClass> {
  static OopMapCacheEntry* volatile _old_entries;
  private:
-  enum { _size        = 32,     // Use fixed size for now
+  enum { _min_size    = 32,     // size bounds, scaled with the number of methods
+         _max_size    = 1024,
          _probe_depth = 3       // probe depth in case of collisions
   };
 
+  const int _size;
   OopMapCacheEntry* volatile * _array;
 
   unsigned int hash_value_for(const methodHandle& method, int bci) const;
@@ -168,7 +170,7 @@ class OopMapCache : public CHeapObj<mtClass> {
   void flush();
 
  public:
-  OopMapCache();
+  OopMapCache(int nof_methods);
   ~OopMapCache();                                // free up memory
 
   // flush cache entry is occupied by an obsolete method
@@ -28,7 +28,9 @@
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "utilities/globalCounter.inline.hpp"
 
 /*
  * There are two separate repository instances.
@@ -112,36 +114,50 @@ size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
         stacktrace->write(sw);
         ++count;
       }
-      if (clear) {
-        delete stacktrace;
-      }
       stacktrace = next;
     }
   }
   if (clear) {
-    memset(_table, 0, sizeof(_table));
-    _entries = 0;
+    clear_table();
   }
   _last_entries = _entries;
   return count;
 }
 
+// Entries are looked up without holding JfrStacktrace_lock (see add_trace()),
+// so they are unlinked from the table first and only deleted once all
+// concurrent readers have left their critical sections.
+void JfrStackTraceRepository::clear_table() {
+  assert_lock_strong(JfrStacktrace_lock);
+  const JfrStackTrace* unlinked = nullptr;
+  for (u4 i = 0; i < TABLE_SIZE; ++i) {
+    JfrStackTrace* const head = _table[i];
+    if (head != nullptr) {
+      JfrStackTrace* tail = head;
+      while (tail->next() != nullptr) {
+        tail = const_cast<JfrStackTrace*>(tail->next());
+      }
+      tail->_next = unlinked;
+      unlinked = head;
+      Atomic::store(&_table[i], (JfrStackTrace*)nullptr);
+    }
+  }
+  GlobalCounter::write_synchronize();
+  while (unlinked != nullptr) {
+    const JfrStackTrace* const next = unlinked->next();
+    delete unlinked;
+    unlinked = next;
+  }
+  _entries = 0;
+}
+
 size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
   MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
   if (repo._entries == 0) {
     return 0;
   }
-  for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = repo._table[i];
-    while (stacktrace != nullptr) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
-      delete stacktrace;
-      stacktrace = next;
-    }
-  }
-  memset(repo._table, 0, sizeof(repo._table));
   const size_t processed = repo._entries;
-  repo._entries = 0;
+  repo.clear_table();
   repo._last_entries = 0;
   return processed;
 }
@@ -198,25 +214,41 @@ void JfrStackTraceRepository::record_for_leak_profiler(JavaThread* current_threa
   }
 }
 
+const JfrStackTrace* JfrStackTraceRepository::find_entry(const JfrStackTrace* table_entry, const JfrStackTrace& stacktrace) {
+  while (table_entry != nullptr) {
+    if (table_entry->equals(stacktrace)) {
+      return table_entry;
+    }
+    table_entry = table_entry->next();
+  }
+  return nullptr;
+}
+
 traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
   assert(stacktrace._nr_of_frames > 0, "invariant");
   const size_t index = stacktrace._hash % TABLE_SIZE;
-  const JfrStackTrace* table_entry = _table[index];
-
-  while (table_entry != nullptr) {
-    if (table_entry->equals(stacktrace)) {
+  {
+    // Most traces are already present, look them up without taking the lock.
+    GlobalCounter::CriticalSection cs(Thread::current());
+    const JfrStackTrace* const table_entry = find_entry(Atomic::load_acquire(&_table[index]), stacktrace);
+    if (table_entry != nullptr) {
       return table_entry->id();
     }
-    table_entry = table_entry->next();
   }
 
   if (!stacktrace.have_lineno()) {
     return 0;
   }
 
+  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+  // Recheck, the trace might have been added concurrently.
+  const JfrStackTrace* const table_entry = find_entry(_table[index], stacktrace);
+  if (table_entry != nullptr) {
+    return table_entry->id();
+  }
+
   traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
+  Atomic::release_store(&_table[index], new JfrStackTrace(id, stacktrace, _table[index]));
   ++_entries;
   return id;
 }
@@ -79,8 +79,12 @@ void AsyncLogWriter::enqueue_locked(LogFileStreamOutput* output, const LogDecora
     return;
   }
 
-  _data_available = true;
-  _lock.notify();
+  // Only the first message after the writer swapped buffers needs to wake it up;
+  // it takes every message enqueued in the meantime with the next swap.
+  if (!_data_available) {
+    _data_available = true;
+    _lock.notify();
+  }
 }
 
 void AsyncLogWriter::enqueue(LogFileStreamOutput& output, const LogDecorations& decorations, const char* msg) {
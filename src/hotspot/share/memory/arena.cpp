@@ -30,6 +30,7 @@
 #include "memory/resourceArea.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
+#include "runtime/thread.hpp"
 #include "runtime/threadCritical.hpp"
 #include "runtime/trimNativeHeap.hpp"
 #include "services/memTracker.inline.hpp"
@@ -45,7 +46,9 @@ STATIC_ASSERT(is_aligned((int)Chunk::size, ARENA_AMALLOC_ALIGNMENT));
 STATIC_ASSERT(is_aligned((int)Chunk::non_pool_size, ARENA_AMALLOC_ALIGNMENT));
 
 // MT-safe pool of same-sized chunks to reduce malloc/free thrashing
-// NB: not using Mutex because pools are used before Threads are initialized
+// NB: not using Mutex because pools are used before Threads are initialized.
+// Each pool has its own spin lock so that arena users of different chunk
+// sizes, and unrelated ThreadCritical users, do not contend with each other.
 class ChunkPool {
   // Our four static pools
   static constexpr int _num_pools = 4;
@@ -53,36 +56,41 @@ class ChunkPool {
 
   Chunk*       _first;
   const size_t _size;         // (inner payload) size of the chunks this pool serves
+  volatile int _lock;         // protects _first
 
   // Returns null if pool is empty.
   Chunk* take_from_pool() {
-    ThreadCritical tc;
+    Thread::SpinAcquire(&_lock, "ChunkPool");
     Chunk* c = _first;
     if (_first != nullptr) {
       _first = _first->next();
     }
+    Thread::SpinRelease(&_lock);
     return c;
   }
   void return_to_pool(Chunk* chunk) {
     assert(chunk->length() == _size, "wrong pool for this chunk");
-    ThreadCritical tc;
+    Thread::SpinAcquire(&_lock, "ChunkPool");
     chunk->set_next(_first);
     _first = chunk;
+    Thread::SpinRelease(&_lock);
   }
 
   // Clear this pool of all contained chunks
   void prune() {
+    Thread::SpinAcquire(&_lock, "ChunkPool");
+    Chunk* cur = _first;
+    _first = nullptr;
+    Thread::SpinRelease(&_lock);
     // Free all chunks while in ThreadCritical lock
     // so NMT adjustment is stable.
     ThreadCritical tc;
-    Chunk* cur = _first;
     Chunk* next = nullptr;
     while (cur != nullptr) {
       next = cur->next();
       os::free(cur);
       cur = next;
     }
-    _first = nullptr;
   }
 
   // Given a (inner payload) size, return the pool responsible for it, or null if the size is non-standard
@@ -96,7 +104,7 @@ class ChunkPool {
   }
 
 public:
-  ChunkPool(size_t size) : _first(nullptr), _size(size) {}
+  ChunkPool(size_t size) : _first(nullptr), _size(size), _lock(0) {}
 
   static void clean() {
     NativeHeapTrimmer::SuspendMark sm("chunk pool cleaner");
@@ -191,6 +191,9 @@ static size_t align_to_page_size(size_t size) {
 
 
 void CodeHeap::on_code_mapping(char* base, size_t size) {
+  // Code is executed right after it is installed, so do not wait for
+  // the OS to back the code heap with large pages.
+  os::collapse_memory(base, size);
 #ifdef LINUX
   extern void linux_wrap_code(char* base, size_t size);
   linux_wrap_code(base, size);
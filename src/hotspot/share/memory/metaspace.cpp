@@ -568,6 +568,9 @@ void Metaspace::initialize_class_space(ReservedSpace rs) {
          is_aligned(rs.size(), Metaspace::reserve_alignment()),
          "wrong alignment");
 
+  os::trace_page_sizes("Compressed Class Space", CompressedClassSpaceSize, rs.size(),
+                       rs.base(), rs.size(), rs.page_size());
+
   MetaspaceContext::initialize_class_space_context(rs);
 
   // This does currently not work because rs may be the result of a split
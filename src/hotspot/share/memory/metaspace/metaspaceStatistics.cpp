@@ -25,6 +25,7 @@
 
 #include "precompiled.hpp"
 #include "memory/metaspace/metaspaceCommon.hpp"
+#include "memory/metaspace/metaspaceSettings.hpp"
 #include "memory/metaspace/metaspaceStatistics.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -87,6 +88,20 @@ void ChunkManagerStats::print_on(outputStream* st, size_t scale) const {
   st->print(", committed: ");
   print_scaled_words_and_percentage(st, total_committed_size, total_size, scale);
   st->cr();
+  // Free chunks smaller than a commit granule cannot be uncommitted until they
+  // merge with their buddies; this is the fragmentation left after purging.
+  st->print("Committed in chunks smaller than a commit granule: ");
+  print_scaled_words_and_percentage(st, committed_word_size_below_granule(), total_committed_size, scale);
+  st->cr();
+}
+
+size_t ChunkManagerStats::committed_word_size_below_granule() const {
+  const chunklevel_t granule_level = chunklevel::level_fitting_word_size(Settings::commit_granule_words());
+  size_t s = 0;
+  for (chunklevel_t l = granule_level + 1; l <= chunklevel::HIGHEST_CHUNK_LEVEL; l++) {
+    s += _committed_word_size[l];
+  }
+  return s;
 }
 
 #ifdef ASSERT
@@ -60,6 +60,9 @@ struct ChunkManagerStats {
   // Returns total committed word size of all chunks in this manager.
   size_t total_committed_word_size() const;
 
+  // Returns committed word size of chunks too small to be uncommitted.
+  size_t committed_word_size_below_granule() const;
+
   void print_on(outputStream* st, size_t scale) const;
 
   DEBUG_ONLY(void verify() const;)
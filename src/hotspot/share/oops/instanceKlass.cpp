@@ -980,6 +980,10 @@ void InstanceKlass::link_methods(TRAPS) {
     // Set up method entry points for compiler and interpreter    .
     m->link_method(m, CHECK);
   }
+
+  if (HotMethodsFile != nullptr) {
+    CompilationPolicy::mark_hot_methods(this);
+  }
 }
 
 // Eagerly initialize superinterfaces that declare default methods (concrete instance: any access)
@@ -1636,7 +1640,7 @@ void InstanceKlass::mask_for(const methodHandle& method, int bci,
     MutexLocker x(OopMapCacheAlloc_lock);
     // Check if _oop_map_cache was allocated while we were waiting for this lock
     if ((oop_map_cache = _oop_map_cache) == nullptr) {
-      oop_map_cache = new OopMapCache();
+      oop_map_cache = new OopMapCache(methods()->length());
       // Ensure _oop_map_cache is stable, since it is examined without a lock
       Atomic::release_store(&_oop_map_cache, oop_map_cache);
     }
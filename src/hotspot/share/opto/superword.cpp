@@ -126,6 +126,7 @@ bool SuperWord::transform_loop(IdealLoopTree* lpt, bool do_optimization) {
         tty->print("cl_exit->in(0) %d", cl_exit->in(0)->_idx); cl_exit->in(0)->dump();
         tty->print("lpt->_head %d", lpt->_head->_idx); lpt->_head->dump();
         lpt->dump_head();
+        trace_conditional_stores(lpt);
       }
     #endif
     return false;
@@ -168,6 +169,22 @@ bool SuperWord::transform_loop(IdealLoopTree* lpt, bool do_optimization) {
   return success;
 }
 
+#ifndef PRODUCT
+void SuperWord::trace_conditional_stores(IdealLoopTree* lpt) const {
+  for (uint i = 0; i < lpt->_body.size(); i++) {
+    Node* n = lpt->_body.at(i);
+    if (!n->is_Store()) {
+      continue;
+    }
+    Node* ctrl = n->in(MemNode::Control);
+    if (ctrl != nullptr && ctrl->is_IfProj() && lpt->is_member(_phase->get_loop(ctrl))) {
+      tty->print_cr("SuperWord::transform_loop: conditional store %d under If %d is not if-converted",
+                    n->_idx, ctrl->in(0)->_idx);
+    }
+  }
+}
+#endif
+
 //------------------------------early unrolling analysis------------------------------
 void SuperWord::unrolling_analysis(int &local_loop_unroll_factor) {
   bool is_slp = true;
@@ -265,6 +265,13 @@ class SuperWord : public ResourceObj {
 
   bool transform_loop(IdealLoopTree* lpt, bool do_optimization);
 
+#ifndef PRODUCT
+  // Print the stores in the loop body that are control dependent on a
+  // conditional branch inside the loop. Such loops are currently rejected
+  // since SuperWord does not if-convert them to masked vector stores.
+  void trace_conditional_stores(IdealLoopTree* lpt) const;
+#endif
+
   void unrolling_analysis(int &local_loop_unroll_factor);
 
   // Accessors for VPointer
@@ -328,6 +328,14 @@ class TwoOopCallbackWrapper : public CallbackWrapper {
 // around the same time then it's possible that the Mutex associated with the
 // tag map will be a hot lock.
 void JvmtiTagMap::set_tag(jobject object, jlong tag) {
+  // resolve the object
+  oop o = JNIHandles::resolve_non_null(object);
+
+  // Untagging an object that was never tagged needs no lock; see get_tag().
+  if (tag == 0 && o->fast_no_hash_check()) {
+    return;
+  }
+
   MutexLocker ml(lock(), Mutex::_no_safepoint_check_flag);
 
   // SetTag should not post events because the JavaThread has to
@@ -335,9 +343,6 @@ void JvmtiTagMap::set_tag(jobject object, jlong tag) {
   // safepoints with the hashmap lock held.
   check_hashmap(nullptr);  /* don't collect dead objects */
 
-  // resolve the object
-  oop o = JNIHandles::resolve_non_null(object);
-
   // see if the object is already tagged
   JvmtiTagMapTable* hashmap = _hashmap;
 
@@ -353,6 +358,16 @@ void JvmtiTagMap::set_tag(jobject object, jlong tag) {
 
 // get the tag for an object
 jlong JvmtiTagMap::get_tag(jobject object) {
+  // resolve the object
+  oop o = JNIHandles::resolve_non_null(object);
+
+  // Tagging an object computes its identity hash before it is added to the
+  // table, so an object without a hash cannot be tagged. Answer that common
+  // case for profilers without contending on the tag map lock.
+  if (o->fast_no_hash_check()) {
+    return 0;
+  }
+
   MutexLocker ml(lock(), Mutex::_no_safepoint_check_flag);
 
   // GetTag should not post events because the JavaThread has to
@@ -360,9 +375,6 @@ jlong JvmtiTagMap::get_tag(jobject object) {
   // safepoints with the hashmap lock held.
   check_hashmap(nullptr); /* don't collect dead objects */
 
-  // resolve the object
-  oop o = JNIHandles::resolve_non_null(object);
-
   return tag_for(this, o);
 }
 
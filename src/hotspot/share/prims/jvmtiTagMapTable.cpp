@@ -124,6 +124,11 @@ void JvmtiTagMapTable::add(oop obj, jlong tag) {
 }
 
 void JvmtiTagMapTable::remove(oop obj) {
+  if (obj->fast_no_hash_check()) {
+    // Objects in the table all have a hashcode.
+    return;
+  }
+
   JvmtiTagMapKey jtme(obj);
   auto clean = [] (const JvmtiTagMapKey& entry, jlong tag) {
     entry.release_weak_handle();
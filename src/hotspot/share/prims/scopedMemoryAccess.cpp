@@ -29,6 +29,7 @@
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "prims/stackwalk.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/jniHandles.inline.hpp"
@@ -86,6 +87,13 @@ class CloseScopedMemoryClosure : public HandshakeClosure {
       return;
     }
 
+    // Once one thread is found inside a scoped access the close fails and the
+    // session stays alive, so the remaining threads need neither the stack walk
+    // nor the deoptimization.
+    if (Atomic::load(&_found)) {
+      return;
+    }
+
     frame last_frame = jt->last_frame();
     RegisterMap register_map(jt,
                              RegisterMap::UpdateMap::include,
@@ -111,6 +119,7 @@ class CloseScopedMemoryClosure : public HandshakeClosure {
       Deoptimization::deoptimize(jt, last_frame);
     }
 
+    oop deopt_oop = JNIHandles::resolve(_deopt);
     const int max_critical_stack_depth = 10;
     int depth = 0;
     for (vframeStream stream(jt); !stream.at_end(); stream.next()) {
@@ -120,9 +129,9 @@ class CloseScopedMemoryClosure : public HandshakeClosure {
         for (int i = 0; i < locals->size(); i++) {
           StackValue* var = locals->at(i);
           if (var->type() == T_OBJECT) {
-            if (var->get_obj() == JNIHandles::resolve(_deopt)) {
+            if (var->get_obj() == deopt_oop) {
               assert(depth < max_critical_stack_depth, "can't have more than %d critical frames", max_critical_stack_depth);
-              _found = true;
+              Atomic::store(&_found, (jboolean)true);
               return;
             }
           }
@@ -733,6 +733,13 @@ const int ObjectAlignmentInBytes = 8;
           "at one time (minimum is 1024).")                                 \
           range(1024, max_jint)                                             \
                                                                             \
+  product(uint, MonitorDeflationIncrementPercent, 0, EXPERIMENTAL,         \
+          "If non-zero, the MonitorDeflationThread deflates at most this "  \
+          "percentage of the in-use monitors (at least 1024, at most "      \
+          "MonitorDeflationMax) per pass, and starts the next pass right "  \
+          "away when the increment was used up")                            \
+          range(0, 100)                                                     \
+                                                                            \
   product(int, MonitorUsedDeflationThreshold, 90, DIAGNOSTIC,               \
           "Percentage of used monitors before triggering deflation (0 is "  \
           "off). The check is performed on GuaranteedSafepointInterval, "   \
@@ -930,6 +937,12 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, UseDynamicNumberOfCompilerThreads, true,                    \
           "Dynamically choose the number of parallel compiler threads")     \
                                                                             \
+  product(uint, DynamicCompilerThreadsCPUPercentage, 100, EXPERIMENTAL,     \
+          "Limit the number of dynamically started threads of each "        \
+          "compiler to this percentage of the active processor count, "     \
+          "which accounts for container CPU quotas")                        \
+          range(1, 1000)                                                    \
+                                                                            \
   product(bool, ReduceNumberOfCompilerThreads, true, DIAGNOSTIC,            \
              "Reduce the number of parallel compiler threads when they "    \
              "are not used")                                                \
@@ -1297,6 +1310,12 @@ const int ObjectAlignmentInBytes = 8;
           "supports sub-millisecond resolution with fractional values.")    \
           range(0, max_jlongDouble LP64_ONLY(/MICROUNITS))                  \
                                                                             \
+  product(double, SafepointSlowThreadsDelay, 0, DIAGNOSTIC,                 \
+          "Log, with -Xlog:safepoint=info, the threads that have not "      \
+          "reached a safepoint after this many milliseconds and the code "  \
+          "location where they stopped (0 is off)")                         \
+          range(0, max_jlongDouble LP64_ONLY(/MICROUNITS))                  \
+                                                                            \
   product(bool, UseSystemMemoryBarrier, false,                              \
           "Try to enable system memory barrier if supported by OS")         \
                                                                             \
@@ -1995,6 +2014,12 @@ const int ObjectAlignmentInBytes = 8;
           "more eagerly at the cost of higher overhead. A value of 0 "      \
           "(default) disables native heap trimming.")                       \
           range(0, UINT_MAX)                                                \
+                                                                            \
+  product(bool, TrimNativeHeapAdaptiveInterval, false, EXPERIMENTAL,        \
+          "Double the native heap trim interval, up to 16 times "           \
+          "TrimNativeHeapInterval, after trims that reclaim less than one " \
+          "percent of the RSS, and return to TrimNativeHeapInterval after " \
+          "a productive trim or a bulk release of native memory")           \
 
 // end of RUNTIME_FLAGS
 
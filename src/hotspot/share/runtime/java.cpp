@@ -31,6 +31,7 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "code/codeCache.hpp"
+#include "compiler/compilationPolicy.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerOracle.hpp"
 #include "gc/shared/collectedHeap.hpp"
@@ -449,6 +450,9 @@ void before_exit(JavaThread* thread, bool halt) {
   assert(!thread->has_pending_exception(), "must be");
 #endif
 
+  if (DumpHotMethodsAtExit != nullptr && UseCompiler) {
+    CompilationPolicy::dump_hot_methods(DumpHotMethodsAtExit);
+  }
 
   // Actual shutdown logic begins here.
 
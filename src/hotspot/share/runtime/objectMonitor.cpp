@@ -1826,12 +1826,18 @@ void ObjectMonitor::notifyAll(TRAPS) {
 // Spinning: Fixed frequency (100%), vary duration
 int ObjectMonitor::TrySpin(JavaThread* current) {
   // Dumb, brutal spin.  Good for comparative measurements against adaptive spinning.
+  // Every exit is counted in SpinSuccesses or SpinFailures, including
+  // the fixed spin, the pre-spin and the admission control refusals.
   int ctr = Knob_FixedSpin;
   if (ctr != 0) {
     while (--ctr >= 0) {
-      if (TryLock(current) > 0) return 1;
+      if (TryLock(current) > 0) {
+        OM_PERFDATA_OP(SpinSuccesses, inc());
+        return 1;
+      }
       SpinPause();
     }
+    OM_PERFDATA_OP(SpinFailures, inc());
     return 0;
   }
 
@@ -1845,6 +1851,7 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
         if (x < Knob_Poverty) x = Knob_Poverty;
         _SpinDuration = x + Knob_BonusB;
       }
+      OM_PERFDATA_OP(SpinSuccesses, inc());
       return 1;
     }
     SpinPause();
@@ -1865,9 +1872,13 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
   // hold the duration constant but vary the frequency.
 
   ctr = _SpinDuration;
-  if (ctr <= 0) return 0;
+  if (ctr <= 0) {
+    OM_PERFDATA_OP(SpinFailures, inc());
+    return 0;
+  }
 
   if (NotRunnable(current, static_cast<JavaThread*>(owner_raw()))) {
+    OM_PERFDATA_OP(SpinFailures, inc());
     return 0;
   }
 
@@ -1938,6 +1949,7 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
           if (x < Knob_Poverty) x = Knob_Poverty;
           _SpinDuration = x + Knob_Bonus;
         }
+        OM_PERFDATA_OP(SpinSuccesses, inc());
         return 1;
       }
 
@@ -1990,8 +2002,12 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
     // in the normal usage of TrySpin(), but it's safest
     // to make TrySpin() as foolproof as possible.
     OrderAccess::fence();
-    if (TryLock(current) > 0) return 1;
+    if (TryLock(current) > 0) {
+      OM_PERFDATA_OP(SpinSuccesses, inc());
+      return 1;
+    }
   }
+  OM_PERFDATA_OP(SpinFailures, inc());
   return 0;
 }
 
@@ -2137,6 +2153,8 @@ PerfCounter * ObjectMonitor::_sync_Parks                       = nullptr;
 PerfCounter * ObjectMonitor::_sync_Notifications               = nullptr;
 PerfCounter * ObjectMonitor::_sync_Inflations                  = nullptr;
 PerfCounter * ObjectMonitor::_sync_Deflations                  = nullptr;
+PerfCounter * ObjectMonitor::_sync_SpinSuccesses               = nullptr;
+PerfCounter * ObjectMonitor::_sync_SpinFailures                = nullptr;
 PerfLongVariable * ObjectMonitor::_sync_MonExtant              = nullptr;
 
 // One-shot global initialization for the sync subsystem.
@@ -2148,7 +2166,9 @@ PerfLongVariable * ObjectMonitor::_sync_MonExtant              = nullptr;
 void ObjectMonitor::Initialize() {
   assert(!InitDone, "invariant");
 
-  if (!os::is_MP()) {
+  // Spinning cannot succeed unless the owner can run concurrently with the
+  // spinner. The active processor count includes container CPU quotas.
+  if (!os::is_MP() || os::active_processor_count() == 1) {
     Knob_SpinLimit = 0;
     Knob_PreSpin   = 0;
     Knob_FixedSpin = -1;
@@ -2172,6 +2192,8 @@ void ObjectMonitor::Initialize() {
     NEWPERFCOUNTER(_sync_FutileWakeups);
     NEWPERFCOUNTER(_sync_Parks);
     NEWPERFCOUNTER(_sync_Notifications);
+    NEWPERFCOUNTER(_sync_SpinSuccesses);
+    NEWPERFCOUNTER(_sync_SpinFailures);
     NEWPERFVARIABLE(_sync_MonExtant);
 #undef NEWPERFCOUNTER
 #undef NEWPERFVARIABLE
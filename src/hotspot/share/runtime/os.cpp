@@ -2108,6 +2108,9 @@ void os::pretouch_memory(void* start, void* end, size_t page_size) {
     char* cur = static_cast<char*>(align_down(start, page_size));
     void* last = align_down(static_cast<char*>(end) - 1, page_size);
     assert(cur <= last, "invariant");
+    if (pd_pretouch_memory(cur, last, page_size)) {
+      return;
+    }
     // Iterate from first page through last (inclusive), being careful to
     // avoid overflow if the last page abuts the end of the address range.
     for ( ; true; cur += page_size) {
@@ -2175,6 +2178,10 @@ void os::realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   pd_realign_memory(addr, bytes, alignment_hint);
 }
 
+void os::collapse_memory(char *addr, size_t bytes) {
+  pd_collapse_memory(addr, bytes);
+}
+
 char* os::reserve_memory_special(size_t size, size_t alignment, size_t page_size,
                                  char* addr, bool executable) {
 
@@ -223,6 +223,9 @@ class os: AllStatic {
   static bool   pd_unmap_memory(char *addr, size_t bytes);
   static void   pd_free_memory(char *addr, size_t bytes, size_t alignment_hint);
   static void   pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint);
+  static void   pd_collapse_memory(char *addr, size_t bytes);
+  // Returns true if the platform has pretouched the pages [first, last] itself.
+  static bool   pd_pretouch_memory(void* first, void* last, size_t page_size);
 
   static char*  pd_reserve_memory_special(size_t size, size_t alignment, size_t page_size,
 
@@ -506,6 +509,9 @@ class os: AllStatic {
   static bool   unmap_memory(char *addr, size_t bytes);
   static void   free_memory(char *addr, size_t bytes, size_t alignment_hint);
   static void   realign_memory(char *addr, size_t bytes, size_t alignment_hint);
+  // Back committed, large page aligned memory with large pages right away,
+  // where the platform supports that.
+  static void   collapse_memory(char *addr, size_t bytes);
 
   // NUMA-specific interface
   static bool   numa_has_group_homing();
@@ -27,6 +27,7 @@
 #include "jvm.h"
 #include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/java.hpp"
@@ -36,6 +37,7 @@
 #include "runtime/perfData.inline.hpp"
 #include "utilities/exceptions.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 PerfDataList*   PerfDataManager::_all = nullptr;
 PerfDataList*   PerfDataManager::_sampled = nullptr;
@@ -528,6 +530,28 @@ PerfDataList* PerfDataList::clone() {
   return copy;
 }
 
+PerfHistogram* PerfDataManager::create_histogram(CounterNS ns, const char* name, TRAPS) {
+  ResourceMark rm;
+  PerfHistogram* h = new PerfHistogram();
+  const char* hns = counter_name(name, "histogram");
+  for (int i = 0; i < PerfHistogram::NUM_BUCKETS; i++) {
+    h->_buckets[i] = create_counter(ns, name_space(hns, i), PerfData::U_Events, CHECK_NULL);
+  }
+  return h;
+}
+
+int PerfHistogram::bucket_for_micros(jlong micros) {
+  if (micros <= 0) {
+    return 0;
+  }
+  return MIN2(log2i(micros) + 1, NUM_BUCKETS - 1);
+}
+
+void PerfHistogram::record(jlong ticks) {
+  const jlong micros = (jlong)((double)ticks * 1000000.0 / (double)os::elapsed_frequency());
+  _buckets[bucket_for_micros(micros)]->inc();
+}
+
 PerfTraceTime::~PerfTraceTime() {
   if (!UsePerfData) return;
   _t.stop();
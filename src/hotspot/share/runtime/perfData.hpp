@@ -619,6 +619,7 @@ class PerfDataList : public CHeapObj<mtInternal> {
     inline PerfData* at(int index);
 };
 
+class PerfHistogram;
 
 /*
  * The PerfDataManager class is responsible for creating PerfData
@@ -783,6 +784,8 @@ class PerfDataManager : AllStatic {
       return create_long_counter(ns, name, u, sh, THREAD);
     }
 
+    static PerfHistogram* create_histogram(CounterNS ns, const char* name, TRAPS);
+
     static void destroy();
     static bool has_PerfData() { return _has_PerfData; }
 };
@@ -802,6 +805,38 @@ class PerfDataManager : AllStatic {
 
 // Utility Classes
 
+/*
+ * PerfHistogram counts durations in a fixed set of event counters named
+ * <name>.histogram.<i>, so that latency distributions can be read from the
+ * hsperfdata file like any other counter. Bucket bounds are powers of two
+ * in microseconds: bucket 0 counts durations below 1 us, bucket i (i > 0)
+ * counts durations in [2^(i-1), 2^i) us, and the last bucket also takes
+ * all longer durations.
+ *
+ * Example:
+ *
+ *    static PerfHistogram* my_histogram = PerfDataManager::create_histogram(SUN_RT, "myTime", CHECK);
+ *
+ *    my_histogram->record(elapsed_ticks);
+ */
+class PerfHistogram : public CHeapObj<mtInternal> {
+  friend class PerfDataManager;
+
+  public:
+    static const int NUM_BUCKETS = 25;
+
+  private:
+    PerfCounter* _buckets[NUM_BUCKETS];
+
+    PerfHistogram() {}
+
+  public:
+    static int bucket_for_micros(jlong micros);
+
+    // Records a duration given in os::elapsed_counter() ticks.
+    void record(jlong ticks);
+};
+
 /*
  * this class will administer a PerfCounter used as a time accumulator
  * for a basic block much like the TraceTime class.
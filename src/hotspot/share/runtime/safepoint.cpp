@@ -69,6 +69,7 @@
 #include "runtime/timerTrace.hpp"
 #include "services/runtimeService.hpp"
 #include "utilities/events.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/systemMemoryBarrier.hpp"
 
@@ -255,12 +256,25 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
   int iterations = 1; // The first iteration is above.
   int64_t start_time = os::javaTimeNanos();
 
+  // Threads still running after SafepointSlowThreadsDelay.
+  GrowableArrayCHeap<JavaThread*, mtInternal> slow_threads;
+  bool slow_threads_recorded = false;
+  jlong slow_threads_time = SafepointTracing::start_of_safepoint() +
+                            (jlong)(SafepointSlowThreadsDelay * NANOSECS_PER_MILLISEC);
+
   do {
     // Check if this has taken too long:
     if (SafepointTimeout && safepoint_limit_time < os::javaTimeNanos()) {
       print_safepoint_timeout();
     }
 
+    if (SafepointSlowThreadsDelay > 0 && !slow_threads_recorded && slow_threads_time < os::javaTimeNanos()) {
+      for (ThreadSafepointState* tss = tss_head; tss != nullptr; tss = tss->get_next()) {
+        slow_threads.append(tss->thread());
+      }
+      slow_threads_recorded = true;
+    }
+
     p_prev = &tss_head;
     ThreadSafepointState *cur_tss = tss_head;
     while (cur_tss != nullptr) {
@@ -289,9 +303,35 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
 
   assert(tss_head == nullptr, "Must be empty");
 
+  if (slow_threads.is_nonempty()) {
+    print_slow_threads(&slow_threads);
+  }
+
   return iterations;
 }
 
+// All threads are stopped now, so the top frame of a slow thread is the
+// safepoint poll it finally reached, typically at the end of a loop that
+// has no poll of its own.
+void SafepointSynchronize::print_slow_threads(GrowableArrayView<JavaThread*>* threads) {
+  LogTarget(Info, safepoint) lt;
+  if (!lt.is_enabled()) {
+    return;
+  }
+  ResourceMark rm;
+  LogStream ls(lt);
+  ls.print_cr("Threads still running after %.3f ms while reaching the safepoint for %s:",
+              SafepointSlowThreadsDelay, VMThread::vm_operation()->name());
+  for (JavaThread* thread : *threads) {
+    ls.print("  %s", thread->name());
+    if (thread->has_last_Java_frame()) {
+      ls.print(" stopped at ");
+      thread->last_frame().print_value_on(&ls, thread);
+    }
+    ls.cr();
+  }
+}
+
 void SafepointSynchronize::arm_safepoint() {
   // Begin the process of bringing the system to a safepoint.
   // Java threads can be in several different states and are
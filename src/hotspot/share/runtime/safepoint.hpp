@@ -47,6 +47,7 @@
 // exit points *must* be at a safepoint.
 
 class ThreadSafepointState;
+template <typename E> class GrowableArrayView;
 
 class SafepointStateTracker {
   uint64_t _safepoint_id;
@@ -110,6 +111,7 @@ class SafepointSynchronize : AllStatic {
 
   // For debug long safepoint
   static void print_safepoint_timeout();
+  static void print_slow_threads(GrowableArrayView<JavaThread*>* threads);
 
   // Helper methods for safepoint procedure:
   static void arm_safepoint();
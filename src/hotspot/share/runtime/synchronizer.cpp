@@ -976,6 +976,19 @@ intptr_t ObjectSynchronizer::FastHashCode(Thread* current, oop obj) {
       if (hash != 0) {                  // if it has a hash, just return it
         return hash;
       }
+      // Unlike a stack-lock, a fast-lock leaves the hash bits in the
+      // object's header, so the owner can install the hash in place
+      // without inflating. Only the owner may do this: the unlocking
+      // CAS in exit() assumes that a changed header means inflation.
+      hash = get_next_hash(current, obj);  // get a new hash
+      temp = mark.copy_set_hash(hash);     // merge the hash into header
+      assert(temp.is_fast_locked(), "invariant: header=" INTPTR_FORMAT, temp.value());
+      test = obj->cas_set_mark(temp, mark);
+      if (test == mark) {                  // if the hash was installed, return it
+        return hash;
+      }
+      // Another thread inflated the lock in the meantime; fall thru
+      // and install the hash in the ObjectMonitor.
     } else if (LockingMode == LM_LEGACY && mark.has_locker() && current->is_lock_owned((address)mark.locker())) {
       // This is a stack-lock owned by the calling thread so fetch the
       // displaced markWord from the BasicLock on the stack.
@@ -1579,8 +1592,20 @@ void ObjectSynchronizer::chk_for_block_req(JavaThread* current, const char* op_n
   }
 }
 
-// Walk the in-use list and deflate (at most MonitorDeflationMax) idle
-// ObjectMonitors. Returns the number of deflated ObjectMonitors.
+// The maximum number of ObjectMonitors to deflate in one call to
+// deflate_idle_monitors(). With MonitorDeflationIncrementPercent the
+// MonitorDeflationThread works in increments that follow the size of the
+// in-use list, so each handshake and delete list stays bounded.
+size_t ObjectSynchronizer::deflation_limit(Thread* current) {
+  if (MonitorDeflationIncrementPercent == 0 || !current->is_monitor_deflation_thread()) {
+    return (size_t)MonitorDeflationMax;
+  }
+  size_t increment = _in_use_list.count() / 100 * MonitorDeflationIncrementPercent;
+  return clamp(increment, (size_t)1024, (size_t)MonitorDeflationMax);
+}
+
+// Walk the in-use list and deflate (at most limit) idle ObjectMonitors.
+// Returns the number of deflated ObjectMonitors.
 //
 // If table != nullptr, we gather owned ObjectMonitors indexed by the
 // owner in the table. Please note that ObjectMonitors where the owner
@@ -1591,12 +1616,13 @@ void ObjectSynchronizer::chk_for_block_req(JavaThread* current, const char* op_n
 //
 size_t ObjectSynchronizer::deflate_monitor_list(Thread* current, LogStream* ls,
                                                 elapsedTimer* timer_p,
-                                                ObjectMonitorsHashtable* table) {
+                                                ObjectMonitorsHashtable* table,
+                                                size_t limit) {
   MonitorList::Iterator iter = _in_use_list.iterator();
   size_t deflated_count = 0;
 
   while (iter.has_next()) {
-    if (deflated_count >= (size_t)MonitorDeflationMax) {
+    if (deflated_count >= limit) {
       break;
     }
     ObjectMonitor* mid = iter.next();
@@ -1684,7 +1710,8 @@ size_t ObjectSynchronizer::deflate_idle_monitors(ObjectMonitorsHashtable* table)
   }
 
   // Deflate some idle ObjectMonitors.
-  size_t deflated_count = deflate_monitor_list(current, ls, &timer, table);
+  size_t limit = deflation_limit(current);
+  size_t deflated_count = deflate_monitor_list(current, ls, &timer, table, limit);
   size_t unlinked_count = 0;
   size_t deleted_count = 0;
   if (deflated_count > 0 || is_final_audit()) {
@@ -1785,6 +1812,13 @@ size_t ObjectSynchronizer::deflate_idle_monitors(ObjectMonitorsHashtable* table)
     _no_progress_cnt++;
   }
 
+  if (MonitorDeflationIncrementPercent > 0 && deflated_count >= limit &&
+      current->is_monitor_deflation_thread()) {
+    // The increment was used up, so there are likely more idle monitors.
+    // Continue with the next increment without waiting for the interval.
+    set_is_async_deflation_requested(true);
+  }
+
   return deflated_count;
 }
 
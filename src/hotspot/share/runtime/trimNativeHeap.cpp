@@ -47,12 +47,26 @@ class NativeHeapTrimmerThread : public NamedThread {
   // and the accuracy in tracking the trimming interval.
   static constexpr int64_t safepoint_poll_ms = 250;
 
+  // With TrimNativeHeapAdaptiveInterval, a trim that reclaims less than
+  // 1/productive_trim_divisor of the RSS doubles the interval, up to
+  // max_backoff_factor times TrimNativeHeapInterval.
+  static constexpr size_t productive_trim_divisor = 100;
+  static constexpr uint max_backoff_factor = 16;
+
   Monitor* const _lock;
   bool _stop;
   uint16_t _suspend_count;
 
+  // Current trim interval, in seconds
+  double _interval_secs;
+
   // Statistics
   uint64_t _num_trims_performed;
+  // Sizes are only collected when they are logged or needed for the
+  // adaptive interval, so _total_reclaimed may cover fewer trims.
+  uint64_t _num_trims_measured;
+  size_t _total_reclaimed;
+  double _total_trim_secs;
 
   bool is_suspended() const {
     assert(_lock->is_locked(), "Must be");
@@ -96,11 +110,10 @@ class NativeHeapTrimmerThread : public NamedThread {
 
     LogStartStopMark lssm;
 
-    const double interval_secs = (double)TrimNativeHeapInterval / 1000;
-
     while (true) {
-      double tnow = now();
-      double next_trim_time = tnow + interval_secs;
+      const double last_trim_time = now();
+      double tnow = last_trim_time;
+      double next_trim_time;
 
       unsigned times_suspended = 0;
       unsigned times_waited = 0;
@@ -110,6 +123,8 @@ class NativeHeapTrimmerThread : public NamedThread {
         MonitorLocker ml(_lock, Mutex::_no_safepoint_check_flag);
         if (_stop) return;
 
+        // The interval may shrink while we wait, see resume().
+        next_trim_time = last_trim_time + _interval_secs;
         while (at_or_nearing_safepoint() || is_suspended() || next_trim_time > tnow) {
           if (is_suspended()) {
             times_suspended ++;
@@ -127,6 +142,7 @@ class NativeHeapTrimmerThread : public NamedThread {
           if (_stop) return;
 
           tnow = now();
+          next_trim_time = last_trim_time + _interval_secs;
         }
       }
 
@@ -144,12 +160,25 @@ class NativeHeapTrimmerThread : public NamedThread {
     os::size_change_t sc = { 0, 0 };
     LogTarget(Info, trimnative) lt;
     const bool logging_enabled = lt.is_enabled();
+    const bool need_sizes = logging_enabled || TrimNativeHeapAdaptiveInterval;
 
-    // We only collect size change information if we are logging; save the access to procfs otherwise.
-    if (os::trim_native_heap(logging_enabled ? &sc : nullptr)) {
-      _num_trims_performed++;
+    // We only collect size change information if we need it; save the access to procfs otherwise.
+    if (os::trim_native_heap(need_sizes ? &sc : nullptr)) {
+      double t2 = now();
+      {
+        MutexLocker ml(_lock, Mutex::_no_safepoint_check_flag);
+        _num_trims_performed++;
+        _total_trim_secs += t2 - t1;
+        if (need_sizes && sc.after != SIZE_MAX) {
+          const size_t reclaimed = sc.after < sc.before ? sc.before - sc.after : 0;
+          _total_reclaimed += reclaimed;
+          _num_trims_measured++;
+          if (TrimNativeHeapAdaptiveInterval) {
+            adjust_interval(reclaimed, sc.before);
+          }
+        }
+      }
       if (logging_enabled) {
-        double t2 = now();
         if (sc.after != SIZE_MAX) {
           const size_t delta = sc.after < sc.before ? (sc.before - sc.after) : (sc.after - sc.before);
           const char sign = sc.after < sc.before ? '-' : '+';
@@ -166,13 +195,31 @@ class NativeHeapTrimmerThread : public NamedThread {
     }
   }
 
+  void adjust_interval(size_t reclaimed, size_t rss) {
+    assert(_lock->is_locked(), "Must be");
+    const double base_secs = (double)TrimNativeHeapInterval / 1000;
+    const double old_secs = _interval_secs;
+    if (reclaimed >= rss / productive_trim_divisor) {
+      _interval_secs = base_secs;
+    } else {
+      _interval_secs = MIN2(_interval_secs * 2, base_secs * max_backoff_factor);
+    }
+    if (_interval_secs != old_secs) {
+      log_debug(trimnative)("Trim interval %.0fms -> %.0fms", to_ms(old_secs), to_ms(_interval_secs));
+    }
+  }
+
 public:
 
   NativeHeapTrimmerThread() :
     _lock(new (std::nothrow) PaddedMonitor(Mutex::nosafepoint, "NativeHeapTrimmer_lock")),
     _stop(false),
     _suspend_count(0),
-    _num_trims_performed(0)
+    _interval_secs((double)TrimNativeHeapInterval / 1000),
+    _num_trims_performed(0),
+    _num_trims_measured(0),
+    _total_reclaimed(0),
+    _total_trim_secs(0)
   {
     set_name("Native Heap Trimmer");
     if (os::create_thread(this, os::vm_thread)) {
@@ -198,6 +245,11 @@ class NativeHeapTrimmerThread : public NamedThread {
       MonitorLocker ml(_lock, Mutex::_no_safepoint_check_flag);
       n = dec_suspend_count();
       if (n == 0) {
+        // Suspensions bracket bulk releases of native memory, so trim
+        // soon afterwards.
+        if (TrimNativeHeapAdaptiveInterval) {
+          _interval_secs = (double)TrimNativeHeapInterval / 1000;
+        }
         ml.notify_all(); // pause end
       }
     }
@@ -218,16 +270,34 @@ class NativeHeapTrimmerThread : public NamedThread {
     // Don't pull lock during error reporting
     Mutex* const lock = VMError::is_error_reported() ? nullptr : _lock;
     int64_t num_trims = 0;
+    int64_t num_measured = 0;
     bool stopped = false;
     uint16_t suspenders = 0;
+    size_t reclaimed = 0;
+    double trim_secs = 0;
+    double interval_secs = 0;
     {
       MutexLocker ml(lock, Mutex::_no_safepoint_check_flag);
       num_trims = _num_trims_performed;
+      num_measured = _num_trims_measured;
       stopped = _stop;
       suspenders = _suspend_count;
+      reclaimed = _total_reclaimed;
+      trim_secs = _total_trim_secs;
+      interval_secs = _interval_secs;
     }
     st->print_cr("Trims performed: " UINT64_FORMAT ", current suspend count: %d, stopped: %d",
                  num_trims, suspenders, stopped);
+    if (num_measured == 0) {
+      st->print("Reclaimed: n/a");
+    } else if (num_measured < num_trims) {
+      st->print("Reclaimed: " PROPERFMT " (measured in " INT64_FORMAT " trims)",
+                PROPERFMTARGS(reclaimed), num_measured);
+    } else {
+      st->print("Reclaimed: " PROPERFMT, PROPERFMTARGS(reclaimed));
+    }
+    st->print_cr(", time spent trimming: %.3fms, current interval: %.0fms",
+                 to_ms(trim_secs), to_ms(interval_secs));
   }
 
 }; // NativeHeapTrimmer
@@ -36,6 +36,8 @@ PerfCounter*  RuntimeService::_sync_time_ticks = nullptr;
 PerfCounter*  RuntimeService::_total_safepoints = nullptr;
 PerfCounter*  RuntimeService::_safepoint_time_ticks = nullptr;
 PerfCounter*  RuntimeService::_application_time_ticks = nullptr;
+PerfHistogram* RuntimeService::_sync_time_histogram = nullptr;
+PerfHistogram* RuntimeService::_safepoint_time_histogram = nullptr;
 
 void RuntimeService::init() {
   if (UsePerfData) {
@@ -57,6 +59,11 @@ void RuntimeService::init() {
               PerfDataManager::create_counter(SUN_RT, "applicationTime",
                                               PerfData::U_Ticks, CHECK);
 
+    _sync_time_histogram =
+              PerfDataManager::create_histogram(SUN_RT, "safepointSyncTime", CHECK);
+
+    _safepoint_time_histogram =
+              PerfDataManager::create_histogram(SUN_RT, "safepointTime", CHECK);
 
     // create performance counters for jvm_version and its capabilities
     PerfDataManager::create_constant(SUN_RT, "jvmVersion", PerfData::U_None,
@@ -89,6 +96,7 @@ void RuntimeService::record_safepoint_begin(jlong app_ticks) {
 void RuntimeService::record_safepoint_synchronized(jlong sync_ticks) {
   if (UsePerfData) {
     _sync_time_ticks->inc(sync_ticks);
+    _sync_time_histogram->record(sync_ticks);
   }
 }
 
@@ -96,6 +104,7 @@ void RuntimeService::record_safepoint_end(jlong safepoint_ticks) {
   HS_PRIVATE_SAFEPOINT_END();
   if (UsePerfData) {
     _safepoint_time_ticks->inc(safepoint_ticks);
+    _safepoint_time_histogram->record(safepoint_ticks);
   }
 }
 
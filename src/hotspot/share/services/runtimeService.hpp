@@ -34,6 +34,8 @@ class RuntimeService : public AllStatic {
   static PerfCounter* _total_safepoints;
   static PerfCounter* _safepoint_time_ticks;   // Accumulated time at safepoints
   static PerfCounter* _application_time_ticks; // Accumulated time not at safepoints
+  static PerfHistogram* _sync_time_histogram;      // Distribution of time spent getting to safepoints
+  static PerfHistogram* _safepoint_time_histogram; // Distribution of time at safepoints
 
 public:
   static void init();
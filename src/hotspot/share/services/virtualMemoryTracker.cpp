@@ -64,6 +64,7 @@ void VirtualMemorySummary::snapshot(VirtualMemorySnapshot* s) {
 }
 
 SortedLinkedList<ReservedMemoryRegion, compare_reserved_region_base>* VirtualMemoryTracker::_reserved_regions;
+ReservedMemoryRegion* VirtualMemoryTracker::_last_found_region = nullptr;
 
 int compare_committed_region(const CommittedMemoryRegion& r1, const CommittedMemoryRegion& r2) {
   return r1.compare(r2);
@@ -344,13 +345,28 @@ bool VirtualMemoryTracker::initialize(NMT_TrackingLevel level) {
   return true;
 }
 
+ReservedMemoryRegion* VirtualMemoryTracker::find_reserved_region(const ReservedMemoryRegion& rgn) {
+  // Reserved regions never overlap, so a cached region containing the whole
+  // range is the one the list search would find.
+  ReservedMemoryRegion* const cached = _last_found_region;
+  if (cached != nullptr && cached->contain_region(rgn.base(), rgn.size())) {
+    assert(cached == _reserved_regions->find(rgn), "Stale reserved region cache");
+    return cached;
+  }
+  ReservedMemoryRegion* const found = _reserved_regions->find(rgn);
+  if (found != nullptr) {
+    _last_found_region = found;
+  }
+  return found;
+}
+
 bool VirtualMemoryTracker::add_reserved_region(address base_addr, size_t size,
     const NativeCallStack& stack, MEMFLAGS flag) {
   assert(base_addr != nullptr, "Invalid address");
   assert(size > 0, "Invalid size");
   assert(_reserved_regions != nullptr, "Sanity check");
   ReservedMemoryRegion  rgn(base_addr, size, stack, flag);
-  ReservedMemoryRegion* reserved_rgn = _reserved_regions->find(rgn);
+  ReservedMemoryRegion* reserved_rgn = find_reserved_region(rgn);
 
   log_debug(nmt)("Add reserved region \'%s\' (" INTPTR_FORMAT ", " SIZE_FORMAT ")",
                 rgn.flag_name(), p2i(rgn.base()), rgn.size());
@@ -425,7 +441,7 @@ void VirtualMemoryTracker::set_reserved_region_type(address addr, MEMFLAGS flag)
   assert(_reserved_regions != nullptr, "Sanity check");
 
   ReservedMemoryRegion   rgn(addr, 1);
-  ReservedMemoryRegion*  reserved_rgn = _reserved_regions->find(rgn);
+  ReservedMemoryRegion*  reserved_rgn = find_reserved_region(rgn);
   if (reserved_rgn != nullptr) {
     assert(reserved_rgn->contain_address(addr), "Containment");
     if (reserved_rgn->flag() != flag) {
@@ -443,7 +459,7 @@ bool VirtualMemoryTracker::add_committed_region(address addr, size_t size,
   assert(_reserved_regions != nullptr, "Sanity check");
 
   ReservedMemoryRegion  rgn(addr, size);
-  ReservedMemoryRegion* reserved_rgn = _reserved_regions->find(rgn);
+  ReservedMemoryRegion* reserved_rgn = find_reserved_region(rgn);
 
   if (reserved_rgn == nullptr) {
     log_debug(nmt)("Add committed region \'%s\', No reserved region found for  (" INTPTR_FORMAT ", " SIZE_FORMAT ")",
@@ -463,7 +479,7 @@ bool VirtualMemoryTracker::remove_uncommitted_region(address addr, size_t size)
   assert(_reserved_regions != nullptr, "Sanity check");
 
   ReservedMemoryRegion  rgn(addr, size);
-  ReservedMemoryRegion* reserved_rgn = _reserved_regions->find(rgn);
+  ReservedMemoryRegion* reserved_rgn = find_reserved_region(rgn);
   assert(reserved_rgn != nullptr, "No reserved region (" INTPTR_FORMAT ", " SIZE_FORMAT ")", p2i(addr), size);
   assert(reserved_rgn->contain_region(addr, size), "Not completely contained");
   const char* flag_name = reserved_rgn->flag_name();  // after remove, info is not complete
@@ -487,6 +503,9 @@ bool VirtualMemoryTracker::remove_released_region(ReservedMemoryRegion* rgn) {
   }
 
   VirtualMemorySummary::record_released_memory(rgn->size(), rgn->flag());
+  if (_last_found_region == rgn) {
+    _last_found_region = nullptr;
+  }
   result =  _reserved_regions->remove(*rgn);
   log_debug(nmt)("Removed region \'%s\' (" INTPTR_FORMAT ", " SIZE_FORMAT ") from _resvered_regions %s" ,
                 backup.flag_name(), p2i(backup.base()), backup.size(), (result ? "Succeeded" : "Failed"));
@@ -499,7 +518,7 @@ bool VirtualMemoryTracker::remove_released_region(address addr, size_t size) {
   assert(_reserved_regions != nullptr, "Sanity check");
 
   ReservedMemoryRegion  rgn(addr, size);
-  ReservedMemoryRegion* reserved_rgn = _reserved_regions->find(rgn);
+  ReservedMemoryRegion* reserved_rgn = find_reserved_region(rgn);
 
   if (reserved_rgn == nullptr) {
     log_debug(nmt)("No reserved region found for (" INTPTR_FORMAT ", " SIZE_FORMAT ")!",
@@ -528,7 +547,7 @@ bool VirtualMemoryTracker::remove_released_region(address addr, size_t size) {
       // so we release them altogether.
       ReservedMemoryRegion class_rgn(addr + reserved_rgn->size(),
                                      (size - reserved_rgn->size()));
-      ReservedMemoryRegion* cls_rgn = _reserved_regions->find(class_rgn);
+      ReservedMemoryRegion* cls_rgn = find_reserved_region(class_rgn);
       assert(cls_rgn != nullptr, "Class space region  not recorded?");
       assert(cls_rgn->flag() == mtClass, "Must be class type");
       remove_released_region(reserved_rgn);
@@ -568,7 +587,7 @@ bool VirtualMemoryTracker::remove_released_region(address addr, size_t size) {
 bool VirtualMemoryTracker::split_reserved_region(address addr, size_t size, size_t split) {
 
   ReservedMemoryRegion  rgn(addr, size);
-  ReservedMemoryRegion* reserved_rgn = _reserved_regions->find(rgn);
+  ReservedMemoryRegion* reserved_rgn = find_reserved_region(rgn);
   assert(reserved_rgn->same_region(addr, size), "Must be identical region");
   assert(reserved_rgn != nullptr, "No reserved region");
   assert(reserved_rgn->committed_size() == 0, "Splitting committed region?");
@@ -410,7 +410,13 @@ class VirtualMemoryTracker : AllStatic {
   static void snapshot_thread_stacks();
 
  private:
+  // Returns the reserved region overlapping rgn. Repeated lookups within the
+  // same reservation, e.g. the heap or the code cache committing piecemeal,
+  // are served from a one-entry cache instead of a search of the list.
+  static ReservedMemoryRegion* find_reserved_region(const ReservedMemoryRegion& rgn);
+
   static SortedLinkedList<ReservedMemoryRegion, compare_reserved_region_base>* _reserved_regions;
+  static ReservedMemoryRegion* _last_found_region;
 };
 
 #endif // SHARE_SERVICES_VIRTUALMEMORYTRACKER_HPP
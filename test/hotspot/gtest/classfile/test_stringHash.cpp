@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "classfile/javaClasses.hpp"
+#include "unittest.hpp"
+
+// The String.hashCode() definition the VM must match.
+static unsigned int reference_hash(const jchar* s, int len) {
+  unsigned int h = 0;
+  for (int i = 0; i < len; i++) {
+    h = 31 * h + s[i];
+  }
+  return h;
+}
+
+static unsigned int reference_hash(const jbyte* s, int len) {
+  unsigned int h = 0;
+  for (int i = 0; i < len; i++) {
+    h = 31 * h + (s[i] & 0xFF);
+  }
+  return h;
+}
+
+TEST(java_lang_String, hash_code_utf16) {
+  jchar chars[37];
+  for (int i = 0; i < 37; i++) {
+    chars[i] = (jchar)(0xFFFF - i * 1021);
+  }
+  for (int len = 0; len <= 37; len++) {
+    ASSERT_EQ(reference_hash(chars, len), java_lang_String::hash_code(chars, len)) << "length " << len;
+  }
+}
+
+TEST(java_lang_String, hash_code_latin1) {
+  jbyte bytes[37];
+  for (int i = 0; i < 37; i++) {
+    bytes[i] = (jbyte)(i * 37 - 128);  // includes negative values
+  }
+  for (int len = 0; len <= 37; len++) {
+    ASSERT_EQ(reference_hash(bytes, len), java_lang_String::hash_code(bytes, len)) << "length " << len;
+  }
+}
@@ -139,3 +139,20 @@ TEST_VM(SymbolTable, test_cleanup_leak) {
 
   ASSERT_EQ(entry2->refcount(), 1) << "Symbol refcount just created is 1";
 }
+
+TEST_VM(SymbolTable, test_permanent_symbol_lookup) {
+  // Repeated lookups of a permanent symbol, which may be served from the
+  // per-thread cache, must find the same symbol and keep it permanent.
+  Symbol* perm = SymbolTable::new_permanent_symbol("perm_symbol_lookup_2023");
+  ASSERT_TRUE(perm->is_permanent()) << "Symbol should be permanent";
+  for (int i = 0; i < 3; i++) {
+    Symbol* found = SymbolTable::probe("perm_symbol_lookup_2023", 23);
+    ASSERT_EQ(found, perm) << "lookup should find the permanent symbol";
+    ASSERT_TRUE(found->is_permanent()) << "Symbol should stay permanent";
+  }
+
+  // A similar non-permanent symbol must not be confused with the cached one.
+  TempNewSymbol other = SymbolTable::new_symbol("perm_symbol_lookup_2024");
+  ASSERT_NE((Symbol*)other, perm) << "different names must give different symbols";
+  ASSERT_EQ(SymbolTable::probe("perm_symbol_lookup_2023", 23), perm);
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CardTable.inline.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/os.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "unittest.hpp"
+
+typedef CardTable::CardValue CardValue;
+
+// Byte-at-a-time reference implementation of the card searches.
+static CardValue* find_first_card_reference(CardValue* start, CardValue* end, bool to_scan) {
+  for (CardValue* c = start; c < end; c++) {
+    if (((*c & G1CardTable::g1_scanned_card_val()) == 0) == to_scan) {
+      return c;
+    }
+  }
+  return end;
+}
+
+static uint next_random(uint& seed) {
+  seed = (uint)os::next_random(seed);
+  return seed;
+}
+
+class G1CardTableScanTest : public ::testing::Test {
+protected:
+  static const size_t NumWords = 1024;
+  static const size_t NumCards = NumWords * sizeof(size_t);
+
+  size_t* _words;
+  CardValue* _cards;
+
+  void SetUp() override {
+    _words = NEW_C_HEAP_ARRAY(size_t, NumWords, mtTest);
+    _cards = reinterpret_cast<CardValue*>(_words);
+  }
+
+  void TearDown() override {
+    FREE_C_HEAP_ARRAY(size_t, _words);
+  }
+
+  // Fill the cards with runs of clean, dirty and scanned cards of random length.
+  void fill_random(uint& seed, uint max_run_length) {
+    const CardValue values[] = { G1CardTable::clean_card_val(),
+                                 G1CardTable::dirty_card_val(),
+                                 G1CardTable::g1_scanned_card_val() };
+    size_t i = 0;
+    while (i < NumCards) {
+      CardValue value = values[next_random(seed) % ARRAY_SIZE(values)];
+      size_t run = 1 + (next_random(seed) % max_run_length);
+      for (size_t j = 0; j < run && i < NumCards; j++) {
+        _cards[i++] = value;
+      }
+    }
+  }
+
+  void check_all_ranges(uint& seed) {
+    for (uint i = 0; i < 200; i++) {
+      size_t from = next_random(seed) % NumCards;
+      size_t to = from + next_random(seed) % (NumCards - from + 1);
+      CardValue* start = _cards + from;
+      CardValue* end = _cards + to;
+      ASSERT_EQ(find_first_card_reference(start, end, true),
+                G1CardTable::find_first_card_to_scan(start, end));
+      ASSERT_EQ(find_first_card_reference(start, end, false),
+                G1CardTable::find_first_card_not_to_scan(start, end));
+    }
+  }
+};
+
+TEST_VM_F(G1CardTableScanTest, uniform) {
+  memset(_cards, G1CardTable::clean_card_val(), NumCards);
+  ASSERT_EQ(_cards + NumCards, G1CardTable::find_first_card_to_scan(_cards, _cards + NumCards));
+  ASSERT_EQ(_cards, G1CardTable::find_first_card_not_to_scan(_cards, _cards + NumCards));
+
+  memset(_cards, G1CardTable::dirty_card_val(), NumCards);
+  ASSERT_EQ(_cards, G1CardTable::find_first_card_to_scan(_cards, _cards + NumCards));
+  ASSERT_EQ(_cards + NumCards, G1CardTable::find_first_card_not_to_scan(_cards, _cards + NumCards));
+
+  // Empty range.
+  ASSERT_EQ(_cards + 3, G1CardTable::find_first_card_to_scan(_cards + 3, _cards + 3));
+}
+
+TEST_VM_F(G1CardTableScanTest, single_card) {
+  // Every position of a single dirty card within clean cards, including the
+  // unaligned prefix and suffix of the searched range.
+  for (size_t pos = 0; pos < 5 * sizeof(size_t) * 4; pos++) {
+    memset(_cards, G1CardTable::clean_card_val(), NumCards);
+    _cards[pos] = G1CardTable::dirty_card_val();
+    for (size_t from = 0; from <= pos; from++) {
+      ASSERT_EQ(_cards + pos, G1CardTable::find_first_card_to_scan(_cards + from, _cards + NumCards));
+      ASSERT_EQ(_cards + pos, G1CardTable::find_first_card_to_scan(_cards + from, _cards + pos + 1));
+    }
+    ASSERT_EQ(_cards + pos, G1CardTable::find_first_card_to_scan(_cards, _cards + pos + 1));
+    ASSERT_EQ(_cards + pos, G1CardTable::find_first_card_to_scan(_cards, _cards + pos));
+  }
+}
+
+TEST_VM_F(G1CardTableScanTest, random) {
+  uint seed = 1234567;
+  for (uint max_run_length : { 1u, 7u, 64u, 1024u }) {
+    fill_random(seed, max_run_length);
+    check_all_ranges(seed);
+  }
+}
@@ -22,6 +22,7 @@
  */
 
 #include "precompiled.hpp"
+#include "runtime/perfData.hpp"
 #include "runtime/perfMemory.hpp"
 #include "unittest.hpp"
 
@@ -41,3 +42,16 @@ TEST_VM_F(PerfMemoryTest, destroy) {
   ASSERT_NE(PerfMemory::capacity(), (size_t)0) << "PerfMemory::_capacity should not be 0";
 }
 
+
+TEST(PerfHistogram, bucket_for_micros) {
+  EXPECT_EQ(PerfHistogram::bucket_for_micros(-1), 0);
+  EXPECT_EQ(PerfHistogram::bucket_for_micros(0), 0);
+  EXPECT_EQ(PerfHistogram::bucket_for_micros(1), 1);
+  EXPECT_EQ(PerfHistogram::bucket_for_micros(2), 2);
+  EXPECT_EQ(PerfHistogram::bucket_for_micros(3), 2);
+  EXPECT_EQ(PerfHistogram::bucket_for_micros(1000), 10);
+  EXPECT_EQ(PerfHistogram::bucket_for_micros(1024), 11);
+  EXPECT_EQ(PerfHistogram::bucket_for_micros((jlong)1 << (PerfHistogram::NUM_BUCKETS - 2)),
+            PerfHistogram::NUM_BUCKETS - 1);
+  EXPECT_EQ(PerfHistogram::bucket_for_micros(max_jlong), PerfHistogram::NUM_BUCKETS - 1);
+}
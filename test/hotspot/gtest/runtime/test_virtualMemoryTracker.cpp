@@ -33,6 +33,7 @@
 #include "precompiled.hpp"
 
 #include "memory/virtualspace.hpp"
+#include "runtime/threadCritical.hpp"
 #include "services/memTracker.hpp"
 #include "services/virtualMemoryTracker.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -546,6 +547,40 @@ class VirtualMemoryTrackerTest {
       check_empty(rmr);
     }
   }
+
+  static ReservedMemoryRegion* find_cached(address addr, size_t size) {
+    ThreadCritical tc;
+    ReservedMemoryRegion rgn(addr, size);
+    ReservedMemoryRegion* const res = VirtualMemoryTracker::find_reserved_region(rgn);
+    EXPECT_EQ(res, VirtualMemoryTracker::_reserved_regions->find(rgn));
+    return res;
+  }
+
+  static void test_find_reserved_region() {
+    const size_t size = 0x01000000;
+    ReservedSpace rs1(size);
+    ReservedSpace rs2(size);
+    address addr1 = (address)rs1.base();
+    address addr2 = (address)rs2.base();
+
+    // Lookups within the same reservation are served from the cache
+    ReservedMemoryRegion* rmr1 = find_cached(addr1, size);
+    ASSERT_NE(rmr1, (ReservedMemoryRegion*)nullptr);
+    EXPECT_EQ(rmr1->base(), addr1);
+    EXPECT_EQ(find_cached(addr1 + 0x1000, 0x1000), rmr1);
+
+    // A lookup in another reservation must not be served from the cache
+    ReservedMemoryRegion* rmr2 = find_cached(addr2 + size - 0x1000, 0x1000);
+    ASSERT_NE(rmr2, (ReservedMemoryRegion*)nullptr);
+    EXPECT_EQ(rmr2->base(), addr2);
+
+    // Releasing the cached region must not leave a dangling cache entry
+    rs2.release();
+    find_cached(addr2, size);
+    EXPECT_EQ(find_cached(addr1, size), rmr1);
+
+    rs1.release();
+  }
 };
 
 TEST_VM(NMT_VirtualMemoryTracker, add_committed_region) {
@@ -563,3 +598,11 @@ TEST_VM(NMT_VirtualMemoryTracker, remove_uncommitted_region) {
     tty->print_cr("skipped.");
   }
 }
+
+TEST_VM(NMT_VirtualMemoryTracker, find_reserved_region) {
+  if (MemTracker::tracking_level() >= NMT_summary) {
+    VirtualMemoryTrackerTest::test_find_reserved_region();
+  } else {
+    tty->print_cr("skipped.");
+  }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Methods written by -XX:DumpHotMethodsAtExit are read back by
+ *          -XX:HotMethodsFile and flagged as hot when their class is linked.
+ * @requires vm.compiler2.enabled & vm.flagless
+ * @library /test/lib
+ * @run driver compiler.tiered.HotMethodsFileTest
+ */
+
+package compiler.tiered;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.StandardOpenOption;
+import java.util.List;
+
+public class HotMethodsFileTest {
+    private static final String HOT_METHOD = Workload.class.getName() + ".hot(I)I";
+
+    public static void main(String[] args) throws Exception {
+        Path file = Path.of("hotMethods.txt");
+
+        // First run: hot() is compiled by C2 and written at exit.
+        OutputAnalyzer output = run("-XX:DumpHotMethodsAtExit=" + file);
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("Dumped [1-9][0-9]* hot methods to " + file);
+        List<String> lines = Files.readAllLines(file);
+        if (!lines.contains(HOT_METHOD)) {
+            throw new RuntimeException(HOT_METHOD + " not found in " + file + ": " + lines);
+        }
+
+        // Comment, empty and overlong lines are skipped when reading the file back.
+        String overlong = "x".repeat(4096);
+        Files.write(file, List.of("# comment", "", overlong, "# " + overlong),
+                    StandardOpenOption.APPEND);
+
+        // Second run: hot() is flagged as hot and the long lines are rejected.
+        output = run("-XX:HotMethodsFile=" + file);
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("Loaded " + lines.size() + " hot methods from " + file);
+        output.shouldContain("Skipping overlong line in hot methods file " + file);
+        output.shouldContain("Hot method from previous run: " + HOT_METHOD);
+        output.shouldNotContain("Hot method from previous run: #");
+        output.shouldNotContain("Hot method from previous run: xxx");
+    }
+
+    private static OutputAnalyzer run(String option) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+                "-XX:+UnlockExperimentalVMOptions",
+                option,
+                "-Xbatch",
+                "-Xlog:jit+compilation=debug",
+                Workload.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        System.out.println(output.getOutput());
+        return output;
+    }
+
+    public static class Workload {
+        static int hot(int n) {
+            int sum = 0;
+            for (int i = 0; i < n; i++) {
+                sum += i ^ n;
+            }
+            return sum;
+        }
+
+        public static void main(String[] args) {
+            int sum = 0;
+            for (int i = 0; i < 100_000; i++) {
+                sum += hot(i & 0xf);
+            }
+            System.out.println(sum);
+        }
+    }
+}
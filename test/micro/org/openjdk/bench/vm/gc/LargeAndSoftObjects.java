@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+import org.openjdk.jmh.infra.Blackhole;
+
+import java.lang.ref.SoftReference;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Allocation patterns that stress collector-specific paths: large
+ * (humongous for G1) primitive and reference arrays that die young, and
+ * a cache of SoftReferences that is continuously refreshed, so that
+ * reference processing is part of every collection.
+ *
+ * Run a single collector with e.g. {@code make test TEST="micro:vm.gc.LargeAndSoftObjects.G1"}.
+ */
+@BenchmarkMode(Mode.Throughput)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+public abstract class LargeAndSoftObjects {
+
+    // 1M and 16M bytes are above half a region for the default G1 region
+    // sizes of a 2g heap.
+    @Param({"1048576", "16777216"})
+    public int largeBytes;
+
+    @Param({"65536"})
+    public int cacheEntries;
+
+    private SoftReference<byte[]>[] cache;
+    private int next;
+
+    @SuppressWarnings("unchecked")
+    @Setup
+    public void setup() {
+        cache = (SoftReference<byte[]>[]) new SoftReference<?>[cacheEntries];
+        for (int i = 0; i < cacheEntries; i++) {
+            cache[i] = new SoftReference<>(new byte[64]);
+        }
+    }
+
+    @Benchmark
+    public byte[] largePrimitiveArray() {
+        return new byte[largeBytes];
+    }
+
+    @Benchmark
+    public Object[] largeReferenceArray() {
+        Object[] a = new Object[largeBytes / 8];
+        a[0] = a;
+        return a;
+    }
+
+    @Benchmark
+    public void softReferenceCache(Blackhole bh) {
+        // Look up one entry and replace another, like a cache with a
+        // steady miss rate.
+        int i = next;
+        next = (i + 1) % cacheEntries;
+        byte[] hit = cache[(i * 31) % cacheEntries].get();
+        bh.consume(hit);
+        cache[i] = new SoftReference<>(new byte[64]);
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseG1GC", "-Xmx2g", "-Xms2g"})
+    public static class G1 extends LargeAndSoftObjects {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseParallelGC", "-Xmx2g", "-Xms2g"})
+    public static class Parallel extends LargeAndSoftObjects {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseSerialGC", "-Xmx2g", "-Xms2g"})
+    public static class Serial extends LargeAndSoftObjects {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseZGC", "-XX:+ZGenerational", "-Xmx2g", "-Xms2g"})
+    public static class Z extends LargeAndSoftObjects {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseShenandoahGC", "-Xmx2g", "-Xms2g"})
+    public static class Shenandoah extends LargeAndSoftObjects {}
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Latency of a (small) full collection while other threads run long
+ * counted loops over arrays, so time-to-safepoint is part of what is
+ * measured. Compare with -XX:-UseCountedLoopSafepoints or a different
+ * -XX:LoopStripMiningIter to see the effect of safepoint polls in loops.
+ */
+@BenchmarkMode(Mode.SampleTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@State(Scope.Benchmark)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+public abstract class TimeToSafepoint {
+
+    @Param({"2"})
+    public int spinners;
+
+    private volatile boolean stop;
+    private Thread[] threads;
+    private volatile long sink;
+
+    @Setup(Level.Trial)
+    public void setup() {
+        stop = false;
+        threads = new Thread[spinners];
+        for (int t = 0; t < spinners; t++) {
+            threads[t] = new Thread(() -> {
+                int[] data = new int[1 << 20];
+                long sum = 0;
+                while (!stop) {
+                    for (int i = 0; i < data.length; i++) {
+                        sum += data[i] * 31 + i;
+                    }
+                }
+                sink = sum;
+            });
+            threads[t].setDaemon(true);
+            threads[t].start();
+        }
+    }
+
+    @TearDown(Level.Trial)
+    public void tearDown() throws InterruptedException {
+        stop = true;
+        for (Thread t : threads) {
+            t.join();
+        }
+    }
+
+    @Benchmark
+    public void systemGC() {
+        System.gc();
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseG1GC", "-Xmx256m", "-Xms256m"})
+    public static class G1 extends TimeToSafepoint {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseParallelGC", "-Xmx256m", "-Xms256m"})
+    public static class Parallel extends TimeToSafepoint {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseSerialGC", "-Xmx256m", "-Xms256m"})
+    public static class Serial extends TimeToSafepoint {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseZGC", "-XX:+ZGenerational", "-Xmx256m", "-Xms256m"})
+    public static class Z extends TimeToSafepoint {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseShenandoahGC", "-Xmx256m", "-Xms256m"})
+    public static class Shenandoah extends TimeToSafepoint {}
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.CompilerControl;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Measures the cost of the reference store barriers of each collector:
+ * field and array stores of old-to-young, young-to-young and null
+ * references, reference array copies and object array clones.
+ *
+ * Run a single collector with e.g. {@code make test TEST="micro:vm.gc.WriteBarrier.G1"}.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+public abstract class WriteBarrier {
+
+    @Param({"1024"})
+    public int size;
+
+    static class Holder {
+        Object field;
+    }
+
+    // Allocated in setup and promoted by the System.gc() calls below, so
+    // stores into them from freshly allocated objects cross generations.
+    private Holder[] oldHolders;
+    private Object[] oldArray;
+    private Object[] srcArray;
+    private Object[] dstArray;
+    private Object[] young;
+
+    @Setup
+    public void setup() {
+        oldHolders = new Holder[size];
+        for (int i = 0; i < size; i++) {
+            oldHolders[i] = new Holder();
+        }
+        oldArray = new Object[size];
+        srcArray = new Object[size];
+        dstArray = new Object[size];
+        for (int i = 0; i < size; i++) {
+            srcArray[i] = new Object();
+        }
+        System.gc();
+        System.gc();
+        young = new Object[size];
+        for (int i = 0; i < size; i++) {
+            young[i] = new Object();
+        }
+    }
+
+    @Benchmark
+    @CompilerControl(CompilerControl.Mode.DONT_INLINE)
+    public void fieldStoreOldToYoung() {
+        Holder[] holders = oldHolders;
+        Object[] values = young;
+        for (int i = 0; i < holders.length; i++) {
+            holders[i].field = values[i];
+        }
+    }
+
+    @Benchmark
+    @CompilerControl(CompilerControl.Mode.DONT_INLINE)
+    public void fieldStoreNull() {
+        Holder[] holders = oldHolders;
+        for (int i = 0; i < holders.length; i++) {
+            holders[i].field = null;
+        }
+    }
+
+    @Benchmark
+    @CompilerControl(CompilerControl.Mode.DONT_INLINE)
+    public Holder fieldStoreYoungToYoung() {
+        // Returned so that escape analysis cannot scalar replace the holder
+        // and drop the stores together with their barriers.
+        Object[] values = young;
+        Holder h = new Holder();
+        for (int i = 0; i < values.length; i++) {
+            h.field = values[i];
+        }
+        return h;
+    }
+
+    @Benchmark
+    @CompilerControl(CompilerControl.Mode.DONT_INLINE)
+    public void arrayStoreOldToYoung() {
+        Object[] dst = oldArray;
+        Object[] values = young;
+        for (int i = 0; i < dst.length; i++) {
+            dst[i] = values[i];
+        }
+    }
+
+    @Benchmark
+    public Object[] arrayStoreFreshArray() {
+        Object[] dst = new Object[size];
+        Object[] values = young;
+        for (int i = 0; i < dst.length; i++) {
+            dst[i] = values[i];
+        }
+        return dst;
+    }
+
+    @Benchmark
+    public void referenceArrayCopy() {
+        System.arraycopy(srcArray, 0, dstArray, 0, size);
+    }
+
+    @Benchmark
+    public Object[] referenceArrayClone() {
+        return srcArray.clone();
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseG1GC", "-Xmx1g", "-Xms1g"})
+    public static class G1 extends WriteBarrier {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseParallelGC", "-Xmx1g", "-Xms1g"})
+    public static class Parallel extends WriteBarrier {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseSerialGC", "-Xmx1g", "-Xms1g"})
+    public static class Serial extends WriteBarrier {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseZGC", "-XX:+ZGenerational", "-Xmx1g", "-Xms1g"})
+    public static class Z extends WriteBarrier {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseShenandoahGC", "-Xmx1g", "-Xms1g"})
+    public static class Shenandoah extends WriteBarrier {}
+}
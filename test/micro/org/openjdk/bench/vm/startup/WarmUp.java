@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.startup;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+import org.openjdk.jmh.infra.Blackhole;
+
+import java.lang.reflect.Method;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Map;
+import java.util.TreeMap;
+import java.util.concurrent.TimeUnit;
+import java.util.function.Function;
+import java.util.stream.Collectors;
+import java.util.stream.IntStream;
+
+/**
+ * Warm-up behaviour from a cold JVM. Every measurement iteration is a single
+ * shot and no warm-up iterations are run, so the per-iteration scores of a
+ * fork show how fast tiered compilation reaches steady state; the first
+ * iteration also includes class loading and linking of the workload.
+ *
+ * The nested classes compare the default CDS archive against -Xshare:off
+ * and against a C1-only configuration. Add
+ * -XX:StartFlightRecording:settings=profile to the fork arguments to record
+ * compilation and class loading events for a run.
+ */
+@BenchmarkMode(Mode.SingleShotTime)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 0)
+@Measurement(iterations = 30)
+@Fork(value = 10)
+public class WarmUp {
+
+    // A cross section of java.base classes that a typical application
+    // touches while starting up but that are not needed by JMH itself.
+    private static final String[] CLASS_NAMES = {
+        "java.util.concurrent.ConcurrentSkipListMap",
+        "java.util.concurrent.ForkJoinPool",
+        "java.util.concurrent.CompletableFuture",
+        "java.util.concurrent.locks.StampedLock",
+        "java.util.regex.Pattern",
+        "java.util.zip.GZIPInputStream",
+        "java.util.zip.ZipFile",
+        "java.time.ZonedDateTime",
+        "java.time.format.DateTimeFormatter",
+        "java.text.DecimalFormat",
+        "java.text.SimpleDateFormat",
+        "java.net.URI",
+        "java.net.URLClassLoader",
+        "java.nio.file.Files",
+        "java.nio.channels.FileChannel",
+        "java.math.BigDecimal",
+        "java.security.MessageDigest",
+        "java.util.HexFormat",
+        "java.util.Base64",
+        "java.util.UUID",
+    };
+
+    @Benchmark
+    public void classLoadingHeavy(Blackhole bh) throws Exception {
+        for (String name : CLASS_NAMES) {
+            bh.consume(Class.forName(name));
+        }
+        // Exercise enough of the loaded code that it gets compiled.
+        bh.consume(java.time.format.DateTimeFormatter.ISO_DATE_TIME.format(java.time.ZonedDateTime.now()));
+        bh.consume(java.util.regex.Pattern.compile("([a-z]+)-(\\d+)").matcher("abc-123").matches());
+        bh.consume(new java.math.BigDecimal("12345.6789").pow(8).toPlainString());
+    }
+
+    @Benchmark
+    public Object lambdaHeavy() {
+        Map<Integer, List<String>> groups = IntStream.range(0, 10_000)
+            .mapToObj(Integer::toString)
+            .filter(s -> s.length() > 1)
+            .map(s -> s + s.charAt(0))
+            .sorted((a, b) -> b.compareTo(a))
+            .collect(Collectors.groupingBy(String::length, TreeMap::new, Collectors.toList()));
+        Function<String, Integer> f = String::length;
+        Function<Integer, Integer> g = x -> x * 31;
+        int sum = 0;
+        for (List<String> l : groups.values()) {
+            for (String s : l) {
+                sum += f.andThen(g).apply(s);
+            }
+        }
+        return sum;
+    }
+
+    @Benchmark
+    public Object reflectionHeavy() throws Exception {
+        List<Object> results = new ArrayList<>();
+        for (Class<?> c : new Class<?>[] { String.class, ArrayList.class, TreeMap.class, StringBuilder.class }) {
+            for (Method m : c.getDeclaredMethods()) {
+                if (m.getParameterCount() == 0 && m.getName().startsWith("is")) {
+                    results.add(m.getName());
+                }
+            }
+        }
+        Method length = String.class.getMethod("length");
+        Method append = StringBuilder.class.getMethod("append", String.class);
+        StringBuilder sb = new StringBuilder();
+        for (int i = 0; i < 10_000; i++) {
+            append.invoke(sb, "x");
+        }
+        results.add(length.invoke(sb.toString()));
+        return results;
+    }
+
+    @Fork(value = 10, jvmArgsAppend = {"-Xshare:off"})
+    public static class NoCDS extends WarmUp {}
+
+    @Fork(value = 10, jvmArgsAppend = {"-XX:TieredStopAtLevel=1"})
+    public static class C1Only extends WarmUp {}
+}